@@ -0,0 +1,94 @@
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+// Regular File includes.
+// The flat positions and their move generators.
+#include "../header/FreecellSolver.hpp"
+#include "../header/KlondikeSolver.hpp"
+// ----------------------------------------------------------------------------
+
+using namespace Solitaire;
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Play random legal moves from many deals, generating the moves at
+///        every step, and report the generations per second.
+/// @param name What to call the position type.
+/// @param deals The amount of deals to play.
+/// @param steps The most moves to play from each deal.
+/// @param load Loads deal "i" into a position.
+template<typename Position, typename Load>
+void Bench(const std::string name,
+           const size_t      deals,
+           const size_t      steps,
+           Load              load)
+{
+   std::mt19937_64 rng(1);
+   Move     moves[max_legal_moves];
+   size_t   generated = 0;
+   size_t   total = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < deals; i++)
+   {
+      Position position;
+      load(static_cast<uint32_t>(i + 1), position);
+      for (size_t step = 0; step < steps; step++)
+      {
+         size_t count = GenerateLegalMoves(position, moves);
+         generated++;
+         total += count;
+         if (count == 0)
+         {
+            break;
+         }
+         Move move = moves[rng() % count];
+         position.Apply(move);
+      }
+   }
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+   std::cout << name << " generations/sec: " << generated / elapsed.count()
+             << " (" << double(total) / generated << " moves each)\n";
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief Measures how fast "GenerateLegalMoves" is for freecell and
+///        klondike positions.
+///        Usage: bench_move_generation [deals]
+/// @return The basic return for a successfully run program.
+int main(int argc, char* argv[])
+{
+   const size_t deals = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                 : 20000;
+
+   Bench<FreecellPosition>("FreecellPosition", deals, 200,
+      [](const uint32_t deal, FreecellPosition& position)
+      {
+         uint8_t order[52];
+         MicrosoftDeals::Deal(deal, order);
+         position.LoadDeal(order);
+      });
+   Bench<KlondikePosition>("KlondikePosition", deals, 200,
+      [](const uint32_t deal, KlondikePosition& position)
+      {
+         uint8_t order[52];
+         MicrosoftDeals::Deal(deal, order);
+         position.LoadDeal(order, 3);
+      });
+
+   return 0;
+}
+// ----------------------------------------------------------------------------
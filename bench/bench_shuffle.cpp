@@ -0,0 +1,154 @@
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+
+// Regular File includes.
+// The decks, piles and both kinds of cards.
+#include "../header/StandardDeck.hpp"
+// Many decks shuffled into one block of bytes.
+#include "../header/DealBatch.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Shuffle one deck over and over and print how many decks a second
+///        that is. The bottom card is added up so the work is not skipped.
+/// @param name What to call it.
+/// @param decks How many times to shuffle.
+/// @param shuffle Shuffles the deck it is given.
+template<typename T, typename Shuffle>
+void Bench(const std::string name, const size_t decks, Shuffle shuffle)
+{
+   StandardDeck<T> deck;
+   size_t check = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < decks; i++)
+   {
+      shuffle(deck);
+      check += deck.GetDeck().front()->GetRank();
+   }
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+   std::cout << name << " decks/sec: " << decks / elapsed.count()
+             << " (" << check << ")\n";
+}
+
+/// @brief A random riffle the way "PutHalvesTogether" did it, taking each
+///        card off the front of its half. This is kept here only to compare
+///        against.
+/// @param deck The deck to riffle.
+/// @param rng The generator.
+template<typename T>
+void RiffleWithErase(StandardDeck<T>& deck, std::mt19937& rng)
+{
+   std::uniform_int_distribution<std::mt19937::result_type> dist1(0, 1);
+   SplitDeck<T> halves = deck.Split(26);
+   const size_t total  = halves.first.size() + halves.second.size();
+   Pile<T> out;
+   out.reserve(total);
+   for (size_t i = 0; i < total; i++)
+   {
+      if ((dist1(rng) == 0 || halves.second.size() == 0) &&
+          halves.first.size() > 0)
+      {
+         out.push_back(std::move(halves.first[0]));
+         halves.first.erase(halves.first.begin());
+      }
+      else if (halves.second.size() > 0)
+      {
+         out.push_back(std::move(halves.second[0]));
+         halves.second.erase(halves.second.begin());
+      }
+   }
+   deck.SetDeck(std::move(out));
+}
+
+/// @brief Time the old shuffle, which made a new "std::random_device" and
+///        "std::mt19937" for every deck, against the deck's own generator.
+/// @param name The name of the card type.
+/// @param decks How many times to shuffle with each.
+template<typename T>
+void BenchCard(const std::string name, const size_t decks)
+{
+   Bench<T>(name + " random_device + mt19937", decks,
+            [](StandardDeck<T>& deck)
+            {
+               std::random_device rd;
+               std::mt19937 rng(rd());
+               Pile<T> pile = deck.Split(52).first;
+               std::shuffle(pile.begin(), pile.end(), rng);
+               deck.SetDeck(std::move(pile));
+            });
+   Bench<T>(name + " xoshiro256**          ", decks,
+            [](StandardDeck<T>& deck) { deck.RandomizeDeck(); });
+
+   std::mt19937 rng(1);
+   Bench<T>(name + " 7 riffles with erase  ", decks / 10,
+            [&rng](StandardDeck<T>& deck)
+            {
+               for (size_t i = 0; i < 7; i++)
+               {
+                  RiffleWithErase(deck, rng);
+               }
+            });
+   Bench<T>(name + " 7 riffles by index    ", decks / 10,
+            [](StandardDeck<T>& deck)
+            {
+               for (size_t i = 0; i < 7; i++)
+               {
+                  deck.Riffle(26, RiffleDownFirst::random,
+                              RiffleType::random);
+               }
+            });
+   Bench<T>(name + " 7 GSR riffles         ", decks / 10,
+            [](StandardDeck<T>& deck) { deck.RiffleGilbertShannonReeds(7); });
+}
+
+/// @brief Time filling a batch of deals.
+/// @param decks The amount of decks in the batch.
+/// @param threads The amount of threads. 0 uses every core.
+void BenchBatch(const size_t decks, const size_t threads)
+{
+   DealBatch batch(decks);
+   auto start = std::chrono::steady_clock::now();
+   batch.Fill(1, threads);
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+   std::cout << "DealBatch " << (threads == 0 ? "every core" : "one thread")
+             << "                   decks/sec: " << decks / elapsed.count()
+             << " (" << size_t(batch.GetRow(decks - 1)[0]) << ")\n";
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief Measures how many decks a second can be shuffled, and how many
+///        can be riffled seven times, and how fast a batch of ten times as
+///        many deals is filled.
+///        Usage: bench_shuffle [decks]
+/// @return The basic return for a successfully run program.
+int main(int argc, char* argv[])
+{
+   const size_t decks = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                 : 1000000;
+
+   BenchCard<StandardPlayingCard>("StandardPlayingCard      ", decks);
+   BenchCard<PackedStandardPlayingCard>("PackedStandardPlayingCard", decks);
+   BenchBatch(decks * 10, 1);
+   BenchBatch(decks * 10, 0);
+
+   return 0;
+}
+// ----------------------------------------------------------------------------
@@ -0,0 +1,438 @@
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+// Regular File includes.
+// The decks, piles and every kind of card.
+#include "../header/StandardDeck.hpp"
+// Many decks shuffled into one block of bytes.
+#include "../header/DealBatch.hpp"
+// The games and their move generators.
+#include "../header/FreecellSolver.hpp"
+#include "../header/KlondikeSolver.hpp"
+// The headless war rules.
+#include "../header/WarEngine.hpp"
+// ----------------------------------------------------------------------------
+
+using namespace Solitaire;
+
+// ----------------------------------------------------------------------------
+// Global Variables block.
+// ----------------------------------------------------------------------------
+
+// Every allocation this program makes is counted here.
+static uint64_t allocations     = 0;
+static uint64_t allocated_bytes = 0;
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Operator Overloads block.
+// ----------------------------------------------------------------------------
+
+/// @brief Count the allocation and hand it to "malloc". The array forms call
+///        this one so they are counted too.
+void* operator new(std::size_t size)
+{
+   allocations++;
+   allocated_bytes += size;
+   if (void* memory = std::malloc(size == 0 ? 1 : size))
+   {
+      return memory;
+   }
+   throw std::bad_alloc();
+}
+
+// These are kept out of line. Once inlined GCC sees "free" on memory from
+// "new" and warns, not knowing "new" was replaced too.
+[[gnu::noinline]] void operator delete(void* memory) noexcept
+{
+   std::free(memory);
+}
+
+[[gnu::noinline]] void operator delete(void* memory, std::size_t) noexcept
+{
+   std::free(memory);
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Type Declarations block.
+// ----------------------------------------------------------------------------
+
+/// @brief What one benchmark measured.
+struct BenchResult
+{
+   std::string name;
+   uint64_t    ops                = 0;
+   double      ns_per_op          = 0;
+   double      allocations_per_op = 0;
+   double      bytes_per_op       = 0;
+};
+
+/// @brief Klondike with the protected parts the benchmarks need.
+class BenchKlondike: public Klondike
+{
+   public:
+      /// @brief Build the screen and work out what would be sent.
+      /// @return The amount of bytes that would be sent.
+      size_t Frame()
+      {
+         BuildScreen();
+         screen.Render(200);
+         return screen.GetLastOutput().size();
+      }
+
+      /// @brief Put a run of twelve alternating colors on the first pile.
+      void SetRun()
+      {
+         board[0].clear();
+         for (int rank = 13; rank > 1; rank--)
+         {
+            board[0].push_back(PackedPolarStandardPlayingCard(rank, rank % 2));
+         }
+      }
+
+      /// @brief Check the run on the first pile.
+      bool CheckRun() { return CheckDescendingPile(1, board[0].size()); }
+};
+
+/// @brief Freecell with the protected parts the benchmarks need.
+class BenchFreecell: public Freecell
+{
+   public:
+      /// @brief Build the screen and work out what would be sent.
+      /// @return The amount of bytes that would be sent.
+      size_t Frame()
+      {
+         BuildScreen();
+         screen.Render(200);
+         return screen.GetLastOutput().size();
+      }
+};
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Keep the compiler from throwing away work whose result is unused.
+/// @param value The result.
+template<typename V>
+inline void Keep(const V& value)
+{
+   asm volatile("" : : "g"(&value) : "memory");
+}
+
+/// @brief Run a benchmark until it has taken long enough to time. It is run
+///        once first so buffers that are kept between calls have grown.
+/// @param results Where the result goes.
+/// @param filter Only run benchmarks with this in their name.
+/// @param seconds About how long to run it for.
+/// @param name The name of the benchmark.
+/// @param body Does some operations and returns how many.
+template<typename Body>
+void Run(std::vector<BenchResult>& results,
+         const std::string&        filter,
+         const double              seconds,
+         const std::string         name,
+         Body                      body)
+{
+   if (name.find(filter) == std::string::npos)
+   {
+      return;
+   }
+
+   body();
+
+   BenchResult result;
+   result.name = name;
+   const uint64_t start_allocations = allocations;
+   const uint64_t start_bytes       = allocated_bytes;
+   const auto     start = std::chrono::steady_clock::now();
+   std::chrono::duration<double> elapsed(0);
+   while (elapsed.count() < seconds)
+   {
+      // Check the clock every so often so reading it is not timed too much.
+      for (size_t i = 0; i < 16; i++)
+      {
+         result.ops += body();
+      }
+      elapsed = std::chrono::steady_clock::now() - start;
+   }
+
+   result.ns_per_op          = elapsed.count() * 1e9 / result.ops;
+   result.allocations_per_op =
+      double(allocations - start_allocations) / result.ops;
+   result.bytes_per_op = double(allocated_bytes - start_bytes) / result.ops;
+   results.push_back(result);
+}
+
+/// @brief The deck benchmarks for one type of card.
+/// @param results Where the results go.
+/// @param filter Only run benchmarks with this in their name.
+/// @param seconds About how long to run each one for.
+/// @param card The name of the type of card.
+template<typename T>
+void BenchDeck(std::vector<BenchResult>& results,
+               const std::string&        filter,
+               const double              seconds,
+               const std::string         card)
+{
+   StandardDeck<T> deck;
+   deck.SetSeed(1);
+
+   Run(results, filter, seconds, "deck.construct." + card, []()
+   {
+      StandardDeck<T> made;
+      Keep(made);
+      return 1;
+   });
+   Run(results, filter, seconds, "deck.copy." + card, [&deck]()
+   {
+      StandardDeck<T> copy(deck);
+      Keep(copy);
+      return 1;
+   });
+   Run(results, filter, seconds, "deck.randomize." + card, [&deck]()
+   {
+      deck.RandomizeDeck();
+      return 1;
+   });
+   Run(results, filter, seconds, "deck.riffle." + card, [&deck]()
+   {
+      deck.Riffle(26, RiffleDownFirst::random, RiffleType::random);
+      return 1;
+   });
+   Run(results, filter, seconds, "deck.riffle_gsr." + card, [&deck]()
+   {
+      deck.RiffleGilbertShannonReeds();
+      return 1;
+   });
+   Run(results, filter, seconds, "deck.cut." + card, [&deck]()
+   {
+      deck.Cut(21);
+      return 1;
+   });
+   Run(results, filter, seconds, "deck.split_and_join." + card, [&deck]()
+   {
+      deck.SetDeck(deck.PutHalvesTogether(deck.Split(26), RiffleType::cut));
+      return 1;
+   });
+}
+
+/// @brief The card benchmarks.
+/// @param results Where the results go.
+/// @param filter Only run benchmarks with this in their name.
+/// @param seconds About how long to run each one for.
+void BenchCards(std::vector<BenchResult>& results,
+                const std::string&        filter,
+                const double              seconds)
+{
+   Run(results, filter, seconds, "card.construct.standard", []()
+   {
+      for (size_t suit = 0; suit < 4; suit++)
+      {
+         for (int rank = 1; rank <= 13; rank++)
+         {
+            StandardPlayingCard card(
+               rank, std::string(CardGraphicsAndInfo::suits[suit]));
+            Keep(card);
+         }
+      }
+      return 52;
+   });
+   Run(results, filter, seconds, "card.construct.packed", []()
+   {
+      for (size_t suit = 0; suit < 4; suit++)
+      {
+         for (int rank = 1; rank <= 13; rank++)
+         {
+            PackedStandardPlayingCard card(rank, suit);
+            Keep(card);
+         }
+      }
+      return 52;
+   });
+
+   StandardDeck<StandardPlayingCard>       cards;
+   StandardDeck<PackedStandardPlayingCard> packed;
+   Run(results, filter, seconds, "card.get_graphic.standard", [&cards]()
+   {
+      size_t bytes = 0;
+      for (const auto& card : cards.GetDeck())
+      {
+         bytes += card->GetGraphic()[4].size();
+      }
+      Keep(bytes);
+      return 52;
+   });
+   Run(results, filter, seconds, "card.get_graphic.packed", [&packed]()
+   {
+      size_t bytes = 0;
+      for (const auto& card : packed.GetDeck())
+      {
+         bytes += card->GetGraphic()[4].size();
+      }
+      Keep(bytes);
+      return 52;
+   });
+}
+
+/// @brief The deal batch and deal rank benchmarks.
+/// @param results Where the results go.
+/// @param filter Only run benchmarks with this in their name.
+/// @param seconds About how long to run each one for.
+void BenchDeals(std::vector<BenchResult>& results,
+                const std::string&        filter,
+                const double              seconds)
+{
+   DealBatch batch(1024);
+   uint64_t  seed = 0;
+   Run(results, filter, seconds, "deal_batch.fill", [&batch, &seed]()
+   {
+      batch.Fill(seed++, 1);
+      return batch.GetRows();
+   });
+
+   std::vector<DealRank::Rank> ranks(batch.GetRows());
+   Run(results, filter, seconds, "deal_rank.encode", [&batch, &ranks]()
+   {
+      for (size_t i = 0; i < batch.GetRows(); i++)
+      {
+         DealRank::Encode(batch.GetRow(i), ranks[i]);
+      }
+      return batch.GetRows();
+   });
+   Run(results, filter, seconds, "deal_rank.decode", [&batch, &ranks]()
+   {
+      for (size_t i = 0; i < batch.GetRows(); i++)
+      {
+         DealRank::Decode(ranks[i], batch.GetRow(i));
+      }
+      return batch.GetRows();
+   });
+}
+
+/// @brief The solitaire and war benchmarks.
+/// @param results Where the results go.
+/// @param filter Only run benchmarks with this in their name.
+/// @param seconds About how long to run each one for.
+void BenchGames(std::vector<BenchResult>& results,
+                const std::string&        filter,
+                const double              seconds)
+{
+   Move moves[max_legal_moves];
+
+   BenchKlondike run;
+   run.DealBySeed(1);
+   run.SetRun();
+   Run(results, filter, seconds, "solitaire.check_descending_pile", [&run]()
+   {
+      Keep(run.CheckRun());
+      return 1;
+   });
+
+   BenchKlondike klondike;
+   klondike.DealBySeed(1);
+   Run(results, filter, seconds, "klondike.legal_moves", [&]()
+   {
+      Keep(GenerateLegalMoves(klondike, moves));
+      return 1;
+   });
+
+   BenchFreecell freecell;
+   freecell.DealByNumber(1);
+   Run(results, filter, seconds, "freecell.legal_moves", [&]()
+   {
+      Keep(GenerateLegalMoves(freecell, moves));
+      return 1;
+   });
+
+   // Each frame is drawn over the last one with one move changed, the way
+   // the screen changes while playing.
+   GenerateLegalMoves(klondike, moves);
+   Run(results, filter, seconds, "klondike.frame", [&]()
+   {
+      Move move = moves[0];
+      klondike.ApplyMove(move);
+      Keep(klondike.Frame());
+      klondike.UndoMove(move);
+      Keep(klondike.Frame());
+      return 2;
+   });
+
+   GenerateLegalMoves(freecell, moves);
+   Run(results, filter, seconds, "freecell.frame", [&]()
+   {
+      Move move = moves[0];
+      freecell.ApplyMove(move);
+      Keep(freecell.Frame());
+      freecell.UndoMove(move);
+      Keep(freecell.Frame());
+      return 2;
+   });
+
+   WarEngine engine(0);
+   uint64_t  seed = 0;
+   Run(results, filter, seconds, "war.round", [&engine, &seed]()
+   {
+      return engine.PlayAGame(seed++, 1000).rounds;
+   });
+}
+
+/// @brief Write the results as JSON.
+/// @param results The results.
+void WriteJson(const std::vector<BenchResult>& results)
+{
+   std::cout << "{\n  \"compiler\": \"" << __VERSION__ << "\",\n"
+             << "  \"benchmarks\": [\n";
+   for (size_t i = 0; i < results.size(); i++)
+   {
+      const BenchResult& result = results[i];
+      std::cout << "    {\"name\": \"" << result.name << "\", "
+                << "\"ops\": " << result.ops << ", "
+                << "\"ns_per_op\": " << result.ns_per_op << ", "
+                << "\"allocations_per_op\": " << result.allocations_per_op
+                << ", \"bytes_per_op\": " << result.bytes_per_op << "}"
+                << (i + 1 < results.size() ? ",\n" : "\n");
+   }
+   std::cout << "  ]\n}\n";
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief Times the hot paths of the decks, cards and games and writes the
+///        results as JSON to standard out.
+///        Usage: bench_suite [filter] [seconds]
+///        Only benchmarks with "filter" in their name are run, and each runs
+///        for about "seconds" (0.2 by default).
+/// @return The basic return for a successfully run program.
+int main(int argc, char* argv[])
+{
+   const std::string filter  = argc > 1 ? argv[1] : "";
+   const double      seconds = argc > 2 ? std::strtod(argv[2], nullptr) : 0.2;
+
+   std::vector<BenchResult> results;
+   results.reserve(64);
+   BenchDeck<StandardPlayingCard>(results, filter, seconds, "standard");
+   BenchDeck<PackedStandardPlayingCard>(results, filter, seconds, "packed");
+   BenchCards(results, filter, seconds);
+   BenchDeals(results, filter, seconds);
+   BenchGames(results, filter, seconds);
+
+   WriteJson(results);
+   return 0;
+}
+// ----------------------------------------------------------------------------
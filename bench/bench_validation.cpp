@@ -0,0 +1,203 @@
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Regular File includes.
+// The decks, piles and both kinds of cards.
+#include "../header/StandardDeck.hpp"
+// ----------------------------------------------------------------------------
+
+using CardGraphicsAndInfo::Suit;
+
+// ----------------------------------------------------------------------------
+// Type Declarations block.
+// ----------------------------------------------------------------------------
+
+/// @brief One move to check. A run of cards is moved from a pile onto the
+///        last card of another, and the last card of the run is also tried
+///        on its foundation.
+/// @tparam T The type of card.
+template<typename T>
+struct Check
+{
+   Pile<T> from;
+   Pile<T> to;
+};
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Make the moves to check. Most runs are descending with alternating
+///        colors so the checks go all the way through, like they do when a
+///        player makes a legal move.
+/// @param count The amount of moves.
+/// @return The moves.
+template<typename T>
+std::vector<Check<T>> MakeChecks(const size_t count)
+{
+   std::mt19937_64 rng(1);
+   std::vector<Check<T>> checks(count);
+   for (Check<T>& check : checks)
+   {
+      const size_t length = 1 + rng() % 6;
+      const int    top    = static_cast<int>(length + 1 +
+                                               rng() % (12 - length));
+      size_t       suit   = rng() % 4;
+      check.to.push_back(CardStorage<T>::Make(top, suit));
+      for (size_t i = 0; i < length; i++)
+      {
+         // Every so often break the run by keeping the color.
+         suit = rng() % 8 == 0 ? suit ^ 2 : (suit + 1 + 2 * (rng() % 2)) % 4;
+         check.from.push_back(CardStorage<T>::Make(top - 1 - int(i), suit));
+      }
+   }
+   return checks;
+}
+
+/// @brief The validation as the games did it with suit and color names.
+///        This is kept here only to compare against.
+/// @return Whether the move is legal.
+template<typename T>
+bool CheckWithStrings(const Check<T>& check)
+{
+   const Pile<T>& pile = check.from;
+   const size_t amount = pile.size();
+
+   // The old "CheckDescendingPile".
+   size_t prev_rank = pile[0]->GetRank();
+   std::string prev_color(pile[0]->GetColor());
+   for (size_t i = 1; i < amount; i++)
+   {
+      size_t curn_rank = pile[i]->GetRank();
+      std::string curnColor(pile[i]->GetColor());
+      if (curnColor == prev_color || !(prev_rank == curn_rank + 1))
+      {
+         return false;
+      }
+      prev_rank = pile[i]->GetRank();
+      prev_color = pile[i]->GetColor();
+   }
+
+   // The old "CheckCanMoveCardOnCard".
+   if (!(pile[0]->GetColor() != check.to.back()->GetColor() &&
+         check.to.back()->GetRank() == pile[0]->GetRank() + 1))
+   {
+      return false;
+   }
+
+   // The old "MoveBoardToStack" check with the "GetStackSuit" if-chain.
+   const std::string stack(pile.back()->GetSuit());
+   size_t stack_suit = 0;
+   if (stack == "spade")
+   {
+      stack_suit = 0;
+   }
+   else if (stack == "heart")
+   {
+      stack_suit = 1;
+   }
+   else if (stack == "club")
+   {
+      stack_suit = 2;
+   }
+   else if (stack == "diamond")
+   {
+      stack_suit = 3;
+   }
+   return pile.back()->GetSuit() == stack && stack_suit < 4;
+}
+
+/// @brief The validation as the games do it now with suit and color values.
+/// @return Whether the move is legal.
+template<typename T>
+bool CheckWithEnums(const Check<T>& check)
+{
+   const Pile<T>& pile = check.from;
+
+   for (size_t i = 1; i < pile.size(); i++)
+   {
+      if (pile[i]->GetColorType() == pile[i - 1]->GetColorType() ||
+          pile[i - 1]->GetRank() != pile[i]->GetRank() + 1)
+      {
+         return false;
+      }
+   }
+
+   if (!(pile[0]->GetColorType() != check.to.back()->GetColorType() &&
+         check.to.back()->GetRank() == pile[0]->GetRank() + 1))
+   {
+      return false;
+   }
+
+   const Suit stack = pile.back()->GetSuitType();
+   return pile.back()->GetSuitType() == stack &&
+          static_cast<size_t>(stack) < 4;
+}
+
+/// @brief Time one way of checking every move a few times over.
+/// @param name What to call it.
+/// @param checks The moves to check.
+/// @param rounds How many times to check all of them.
+/// @param validate The check.
+template<typename T, typename Validate>
+void Bench(const std::string            name,
+           const std::vector<Check<T>>& checks,
+           const size_t                 rounds,
+           Validate                     validate)
+{
+   size_t legal = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (size_t round = 0; round < rounds; round++)
+   {
+      for (const Check<T>& check : checks)
+      {
+         legal += validate(check);
+      }
+   }
+   std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+   std::cout << name << " ns/move: "
+             << elapsed.count() / (rounds * checks.size())
+             << " (" << legal << " legal)\n";
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief Measures what it costs to check one move with suit and color
+///        names against checking it with suit and color values.
+///        Usage: bench_validation [rounds]
+/// @return The basic return for a successfully run program.
+int main(int argc, char* argv[])
+{
+   const size_t rounds = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                  : 100;
+   const size_t count  = 10000;
+
+   const auto cards  = MakeChecks<StandardPlayingCard>(count);
+   const auto packed = MakeChecks<PackedStandardPlayingCard>(count);
+
+   Bench("StandardPlayingCard strings      ", cards, rounds,
+         CheckWithStrings<StandardPlayingCard>);
+   Bench("StandardPlayingCard enums        ", cards, rounds,
+         CheckWithEnums<StandardPlayingCard>);
+   Bench("PackedStandardPlayingCard strings", packed, rounds,
+         CheckWithStrings<PackedStandardPlayingCard>);
+   Bench("PackedStandardPlayingCard enums  ", packed, rounds,
+         CheckWithEnums<PackedStandardPlayingCard>);
+
+   return 0;
+}
+// ----------------------------------------------------------------------------
@@ -0,0 +1,139 @@
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+// Regular File includes.
+// This is the header file for the headless war rules.
+#include "../header/WarEngine.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief The war rules on the old hand representation: heap allocated
+///        cards in a vector with the top at the back and won cards inserted
+///        at the front. Kept here only to compare against.
+/// @param seed The seed for the game.
+/// @param max_rounds Stop the game after this many rounds.
+/// @return The amount of rounds played.
+size_t PlaySplitDeckGame(const uint64_t seed, const size_t max_rounds)
+{
+   std::mt19937_64 rng(seed);
+   StandardDeck<StandardPlayingCard> deck;
+   deck.RandomizeDeck(rng);
+   SplitDeck<StandardPlayingCard> hands = deck.Split(26);
+
+   auto rank = [](const Pile<StandardPlayingCard>& hand)
+   {
+      return hand.back()->GetRank();
+   };
+   auto move_cards = [&rng](Pile<StandardPlayingCard>& cards,
+                            Pile<StandardPlayingCard>& winner)
+   {
+      std::shuffle(cards.begin(), cards.end(), rng);
+      auto iter = winner.begin();
+      while (!cards.empty())
+      {
+         iter = winner.insert(iter, std::move(cards.back()));
+         cards.pop_back();
+      }
+   };
+
+   size_t rounds = 0;
+   while (!hands.first.empty() && !hands.second.empty() &&
+          rounds < max_rounds)
+   {
+      rounds++;
+      Pile<StandardPlayingCard> stack;
+      while (true)
+      {
+         int opp = rank(hands.first);
+         int pla = rank(hands.second);
+         stack.push_back(std::move(hands.first.back()));
+         stack.push_back(std::move(hands.second.back()));
+         hands.first.pop_back();
+         hands.second.pop_back();
+
+         if ((opp < pla && opp != 1) || (pla == 1 && opp != 1))
+         {
+            move_cards(stack, hands.second);
+            break;
+         }
+         else if (opp > pla || (opp == 1 && pla != 1))
+         {
+            move_cards(stack, hands.first);
+            break;
+         }
+         else if (hands.first.empty() || hands.second.empty())
+         {
+            return rounds;
+         }
+
+         for (int i = 0; i < 3; i++)
+         {
+            if (hands.first.size() > 1 && hands.second.size() > 1)
+            {
+               stack.push_back(std::move(hands.first.back()));
+               stack.push_back(std::move(hands.second.back()));
+               hands.first.pop_back();
+               hands.second.pop_back();
+            }
+         }
+      }
+   }
+
+   return rounds;
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief Compares rounds per second of war on the old "SplitDeck" hands and
+///        on the ring buffer hands "WarEngine" uses.
+///        Usage: bench_war_hand [games]
+/// @return The basic return for a successfully run program.
+int main(int argc, char* argv[])
+{
+   const size_t games = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                 : 20000;
+
+   // The old representation.
+   size_t rounds = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < games; i++)
+   {
+      rounds += PlaySplitDeckGame(i, 1000);
+   }
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+   const double split_deck_rate = rounds / elapsed.count();
+   std::cout << "SplitDeck<StandardPlayingCard> rounds/sec: "
+             << split_deck_rate << "\n";
+
+   // The ring buffer hands.
+   WarEngine engine;
+   rounds = 0;
+   start = std::chrono::steady_clock::now();
+   for (size_t i = 0; i < games; i++)
+   {
+      rounds += engine.PlayAGame(i, 1000).rounds;
+   }
+   elapsed = std::chrono::steady_clock::now() - start;
+   const double ring_rate = rounds / elapsed.count();
+   std::cout << "CircularHand<PackedStandardPlayingCard> rounds/sec: "
+             << ring_rate << "\n";
+
+   std::cout << "Speed up: " << ring_rate / split_deck_rate << "x\n";
+
+   return 0;
+}
+// ----------------------------------------------------------------------------
@@ -6,6 +6,7 @@ int main()
 {
    Freecell freecell;
    freecell.PlayGame();
+   TRACE_WRITE("freecell-trace.json");
 
    return 0;
 }
\ No newline at end of file
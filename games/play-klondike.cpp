@@ -6,6 +6,7 @@ int main()
 {
    Klondike klondike;
    klondike.PlayGame();
+   TRACE_WRITE("klondike-trace.json");
 
    return 0;
 }
\ No newline at end of file
@@ -4,6 +4,7 @@ int main()
 {
    War war;
    war.PlayGame();
+   TRACE_WRITE("war-trace.json");
 
    return 0;
 }
\ No newline at end of file
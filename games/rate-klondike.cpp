@@ -0,0 +1,133 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../header/KlondikeSolver.hpp"
+#include "../header/WorkStealingRange.hpp"
+
+using namespace Solitaire;
+
+/// @brief What happened to one deal.
+struct DealResult
+{
+   KlondikeSolveStatus status = KlondikeSolveStatus::gave_up;
+   uint32_t            nodes  = 0;
+   double              rate   = 0;
+};
+
+/// @brief Rates how hard every seeded klondike deal in a range is.
+///        Usage: rate-klondike first last [draw] [plays] [threads]
+///               [max_nodes]
+///        Draw is 1 or 3 (the default). Plays is how many games are played
+///        without seeing the face down cards to estimate the win rate
+///        (default 20). Threads of 0 uses every core.
+///
+///        Lines are "deal,thoughtful,nodes,win_rate" in deal order.
+///        "thoughtful" is whether the search seeing every card solved the
+///        deal, ran out of positions or gave up, and "win_rate" is the
+///        fraction of games won seeing only what a player would. Deals are
+///        the same ones "Klondike::DealBySeed" gives.
+int main(int argc, char* argv[])
+{
+   if (argc < 3)
+   {
+      std::cerr << "Usage: rate-klondike first last [draw] [plays] [threads]"
+                << " [max_nodes]\n";
+      return 1;
+   }
+
+   // Read the arguments.
+   const uint32_t first     = std::strtoul(argv[1], nullptr, 10);
+   const uint32_t last      = std::strtoul(argv[2], nullptr, 10);
+   const uint8_t  draw      = argc > 3 && std::atoi(argv[3]) == 1 ? 1 : 3;
+   const size_t   plays     = argc > 4 ? std::strtoull(argv[4], nullptr, 10)
+                                       : 20;
+   size_t         threads   = argc > 5 ? std::strtoull(argv[5], nullptr, 10)
+                                       : 0;
+   const uint64_t max_nodes = argc > 6 ? std::strtoull(argv[6], nullptr, 10)
+                                       : 1000000;
+   if (last < first)
+   {
+      std::cerr << "The last deal is before the first.\n";
+      return 1;
+   }
+   // The range hands out indices that fit in 32 bits.
+   const uint64_t count = uint64_t(last) - first + 1;
+   if (count > UINT32_MAX)
+   {
+      std::cerr << "A range can hold at most " << UINT32_MAX << " deals.\n";
+      return 1;
+   }
+   if (threads == 0)
+   {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+   }
+
+   std::vector<DealResult> results(count);
+   WorkStealingRange       range(count, threads);
+
+   auto start = std::chrono::steady_clock::now();
+   std::vector<std::thread> pool;
+   for (size_t worker = 0; worker < threads; worker++)
+   {
+      pool.emplace_back([&, worker]()
+      {
+         KlondikeSolver   solver;
+         KlondikePosition position;
+         uint8_t          order[52];
+         uint64_t         index;
+         while (range.Next(worker, index))
+         {
+            uint32_t deal = static_cast<uint32_t>(first + index);
+            MicrosoftDeals::Deal(deal, order);
+            position.LoadDeal(order, draw);
+            KlondikeSolveResult solved =
+               solver.SolveThoughtful(position, max_nodes, false);
+
+            DealResult& out = results[index];
+            out.status = solved.status;
+            out.nodes  = static_cast<uint32_t>(solved.nodes);
+            // The search leaves some moves out, so even an exhausted deal
+            // is played.
+            out.rate   = KlondikeSolver::EstimateWinRate(position, plays,
+                                                         deal);
+         }
+      });
+   }
+   for (auto& thread : pool)
+   {
+      thread.join();
+   }
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+   // Write the results.
+   static const char* names[3] = {"solved", "exhausted", "gave_up"};
+   uint64_t totals[3] = {0, 0, 0};
+   double   rates = 0;
+   for (uint64_t i = 0; i < count; i++)
+   {
+      const DealResult& result = results[i];
+      uint8_t status = static_cast<uint8_t>(result.status);
+      totals[status]++;
+      rates += result.rate;
+      std::printf("%u,%s,%u,%.3f\n", static_cast<uint32_t>(first + i),
+                  names[status], result.nodes, result.rate);
+   }
+   std::fflush(stdout);
+
+   // Report.
+   std::cerr << "Deals:         " << count << "\n"
+             << "Draw:          " << int(draw) << "\n"
+             << "Solved:        " << totals[0] << "\n"
+             << "Exhausted:     " << totals[1] << "\n"
+             << "Gave up:       " << totals[2] << "\n"
+             << "Mean win rate: " << rates / count << "\n"
+             << "Seconds:       " << elapsed.count() << "\n";
+
+   return 0;
+}
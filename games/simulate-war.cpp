@@ -0,0 +1,68 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#include "../header/WarMonteCarlo.hpp"
+
+/// @brief Plays a lot of headless games of war and reports how fast it went.
+///        Usage: simulate-war [games] [seed] [max_rounds] [threads] [order]
+///        Game "i" is seeded from the seed and "i" alone so the results are
+///        the same for any amount of threads. Threads of 0 uses every core.
+///        Order is "shuffled" (the default) or "played". With "played" won
+///        cards go back in the order they were played and games that loop
+///        forever are stopped as soon as the loop is found.
+int main(int argc, char* argv[])
+{
+   // Read the arguments.
+   const uint64_t games      = argc > 1 ? std::strtoull(argv[1], nullptr, 10)
+                                        : 1000000;
+   const uint64_t seed       = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                                        : 0;
+   const size_t   max_rounds = argc > 3 ? std::strtoull(argv[3], nullptr, 10)
+                                        : 1000;
+   const size_t   threads    = argc > 4 ? std::strtoull(argv[4], nullptr, 10)
+                                        : 0;
+
+   WarRules rules;
+   if (argc > 5 && std::strcmp(argv[5], "played") == 0)
+   {
+      rules.return_order = WarReturnOrder::played;
+      rules.detect_cycles = true;
+   }
+
+   WarMonteCarlo runner(seed, max_rounds, threads, rules);
+
+   auto start = std::chrono::steady_clock::now();
+   WarStatistics stats = runner.Run(games);
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+   // A checksum of the histogram so runs can be compared at a glance.
+   uint64_t checksum = 0;
+   for (size_t i = 0; i < stats.length_histogram.size(); i++)
+   {
+      checksum = Random::SplitMix64(checksum ^ stats.length_histogram[i]);
+   }
+
+   // Report.
+   std::cout << "Games:         " << stats.games << "\n"
+             << "Threads:       " << runner.GetThreads() << "\n"
+             << "Player won:    " << stats.outcomes[0] << "\n"
+             << "Opponent won:  " << stats.outcomes[1] << "\n"
+             << "Ended on war:  " << stats.outcomes[2] << "\n"
+             << "Cycling:       " << stats.outcomes[3] << "\n"
+             << "Capped:        " << stats.outcomes[4] << "\n"
+             << "Mean rounds:   "
+             << (games ? double(stats.total_rounds) / games : 0) << "\n"
+             << "Mean wars:     "
+             << (games ? double(stats.total_wars) / games : 0) << "\n"
+             << "Rounds p50:    " << stats.Percentile(0.5) << "\n"
+             << "Rounds p90:    " << stats.Percentile(0.9) << "\n"
+             << "Rounds p99:    " << stats.Percentile(0.99) << "\n"
+             << "Checksum:      " << std::hex << checksum << std::dec << "\n"
+             << "Seconds:       " << elapsed.count() << "\n"
+             << "Games/sec:     " << games / elapsed.count() << "\n";
+
+   return 0;
+}
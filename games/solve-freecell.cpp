@@ -0,0 +1,172 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../header/FreecellSolver.hpp"
+#include "../header/WorkStealingRange.hpp"
+
+using namespace Solitaire;
+
+/// @brief What happened to one deal.
+struct DealResult
+{
+   FreecellSolveStatus status = FreecellSolveStatus::gave_up;
+   uint32_t            nodes  = 0;
+   uint16_t            length = 0;
+   uint32_t            micros = 0;
+   // Set once the rest is filled in, so the results can be written while
+   // later deals are still being solved.
+   std::atomic<bool>   done{false};
+};
+
+/// @brief Write one deal's result to standard out.
+/// @param deal The deal number.
+/// @param result What happened to it.
+/// @param binary Whether to write a binary record instead of a CSV line.
+void WriteResult(const uint32_t deal, const DealResult& result,
+                 const bool binary)
+{
+   static const char* names[3] = {"solved", "unsolvable", "gave_up"};
+   uint8_t status = static_cast<uint8_t>(result.status);
+   if (binary)
+   {
+      unsigned char record[16] = {};
+      std::memcpy(record, &deal, 4);
+      record[4] = status;
+      std::memcpy(record + 6, &result.length, 2);
+      std::memcpy(record + 8, &result.nodes, 4);
+      std::memcpy(record + 12, &result.micros, 4);
+      std::fwrite(record, 1, sizeof(record), stdout);
+   }
+   else
+   {
+      std::printf("%u,%s,%u,%u,%.3f\n", deal, names[status], result.nodes,
+                  unsigned(result.length), result.micros / 1000.0);
+   }
+}
+
+/// @brief Solves every numbered freecell deal in a range.
+///        Usage: solve-freecell first last [threads] [max_nodes] [format]
+///        Threads of 0 uses every core. Format is "csv" (the default) or
+///        "binary". Results are written to standard out in deal order as
+///        soon as every deal before them is done, and a summary goes to
+///        standard error. A range can hold at most 2^32 - 1 deals.
+///
+///        CSV lines are "deal,status,nodes,length,ms". Binary records are 16
+///        bytes in the machine's byte order: deal (4), status (1, 0 solved,
+///        1 unsolvable, 2 gave up), unused (1), length (2), nodes (4) and
+///        microseconds (4).
+///
+///        Each thread keeps one solver for all of its deals so the seen
+///        table and search buffers are only made once per thread. Deals are
+///        handed out by a work stealing range so a few slow deals don't
+///        leave the other threads waiting.
+int main(int argc, char* argv[])
+{
+   if (argc < 3)
+   {
+      std::cerr << "Usage: solve-freecell first last [threads] [max_nodes]"
+                << " [csv|binary]\n";
+      return 1;
+   }
+
+   // Read the arguments.
+   const uint32_t first     = std::strtoul(argv[1], nullptr, 10);
+   const uint32_t last      = std::strtoul(argv[2], nullptr, 10);
+   size_t         threads   = argc > 3 ? std::strtoull(argv[3], nullptr, 10)
+                                       : 0;
+   const uint64_t max_nodes = argc > 4 ? std::strtoull(argv[4], nullptr, 10)
+                                       : 1000000;
+   const bool     binary    = argc > 5 && std::strcmp(argv[5], "binary") == 0;
+   if (last < first)
+   {
+      std::cerr << "The last deal is before the first.\n";
+      return 1;
+   }
+   // The range hands out indices that fit in 32 bits.
+   const uint64_t count = uint64_t(last) - first + 1;
+   if (count > UINT32_MAX)
+   {
+      std::cerr << "A range can hold at most " << UINT32_MAX << " deals.\n";
+      return 1;
+   }
+   if (threads == 0)
+   {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+   }
+
+   std::vector<DealResult> results(count);
+   WorkStealingRange       range(count, threads);
+
+   auto start = std::chrono::steady_clock::now();
+   std::vector<std::thread> pool;
+   for (size_t worker = 0; worker < threads; worker++)
+   {
+      pool.emplace_back([&, worker]()
+      {
+         FreecellSolver   solver;
+         FreecellPosition position;
+         uint8_t          order[52];
+         uint64_t         index;
+         while (range.Next(worker, index))
+         {
+            auto began = std::chrono::steady_clock::now();
+            MicrosoftDeals::Deal(static_cast<uint32_t>(first + index), order);
+            position.LoadDeal(order);
+            FreecellSolveResult solved = solver.Solve(position, max_nodes,
+                                                      false);
+            std::chrono::duration<double, std::micro> took =
+               std::chrono::steady_clock::now() - began;
+
+            DealResult& out = results[index];
+            out.status = solved.status;
+            out.nodes  = static_cast<uint32_t>(solved.nodes);
+            out.length = static_cast<uint16_t>(solved.length);
+            out.micros = static_cast<uint32_t>(took.count());
+            out.done.store(true, std::memory_order_release);
+         }
+      });
+   }
+
+   // Write the results while the threads work. Whenever the next deal in
+   // order isn't done yet, flush what has been written and wait a little.
+   uint64_t totals[3] = {0, 0, 0};
+   for (uint64_t i = 0; i < count; i++)
+   {
+      const DealResult& result = results[i];
+      if (!result.done.load(std::memory_order_acquire))
+      {
+         std::fflush(stdout);
+         while (!result.done.load(std::memory_order_acquire))
+         {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+         }
+      }
+      totals[static_cast<uint8_t>(result.status)]++;
+      WriteResult(static_cast<uint32_t>(first + i), result, binary);
+   }
+   std::fflush(stdout);
+   for (auto& thread : pool)
+   {
+      thread.join();
+   }
+   std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+   // Report.
+   std::cerr << "Deals:         " << count << "\n"
+             << "Threads:       " << threads << "\n"
+             << "Solved:        " << totals[0] << "\n"
+             << "Unsolvable:    " << totals[1] << "\n"
+             << "Gave up:       " << totals[2] << "\n"
+             << "Seconds:       " << elapsed.count() << "\n"
+             << "Deals/sec:     " << count / elapsed.count() << "\n";
+
+   return 0;
+}
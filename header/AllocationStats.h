@@ -0,0 +1,366 @@
+#ifndef ALLOCATIONSTATS_H
+#define ALLOCATIONSTATS_H
+
+// ----------------------------------------------------------------------------
+// Include block.
+// ----------------------------------------------------------------------------
+
+// Standard library include.
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+#include <ostream>
+#include <string_view>
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Namespace block.
+// ----------------------------------------------------------------------------
+
+/// @brief Counts heap allocations and puts them down to the game operations
+///        they happened in.
+///
+///        This is off unless the program is built with "ALLOCATION_STATS"
+///        defined (for example "g++ -DALLOCATION_STATS ..."). Then the
+///        global "operator new" and "operator delete" are replaced to count
+///        every allocation, and each "ALLOCATION_SCOPE(operation)" adds what
+///        was allocated while it was open to that operation. Without it the
+///        scopes are empty and nothing is counted.
+///
+///        Scopes can be inside each other and each one counts everything
+///        under it, so the moves made by an auto-move are counted as moves
+///        and as part of the auto-move.
+///
+///        The operators are defined in this header, so only define
+///        "ALLOCATION_STATS" in programs built from a single file. All the
+///        programs here are.
+namespace AllocationStats
+{
+   // -------------------------------------------------------------------------
+   // Type Declarations block.
+   // -------------------------------------------------------------------------
+
+   /// @brief The operations allocations are put down to.
+   enum class Operation : uint8_t
+   {
+      // Dealing a game.
+      deal,
+      // One move, by the player or automatic.
+      move,
+      // A run of automatic moves to the stacks.
+      auto_move,
+      // Building and drawing one screen.
+      frame,
+      // Shuffling, riffling or cutting a deck.
+      shuffle
+   };
+
+   /// @brief The amount of operations.
+   inline constexpr size_t operation_count = 5;
+
+   /// @brief The names of the operations, for reports.
+   inline constexpr std::array<std::string_view, operation_count>
+      operation_names = {"deal", "move", "auto_move", "frame", "shuffle"};
+
+   /// @brief What was allocated in one operation over all its calls.
+   struct Counts
+   {
+      // The amount of times the operation was done.
+      uint64_t calls           = 0;
+      // The amount of allocations.
+      uint64_t allocations     = 0;
+      // The bytes asked for.
+      uint64_t bytes           = 0;
+      // The most bytes that were allocated and not yet freed at one time
+      // during one call, over what there was when the call started.
+      uint64_t peak_live_bytes = 0;
+   };
+
+   /// @brief What was allocated over the whole program.
+   struct Totals
+   {
+      // The amount of allocations.
+      uint64_t allocations     = 0;
+      // The bytes asked for.
+      uint64_t bytes           = 0;
+      // The bytes allocated and not yet freed.
+      int64_t  live_bytes      = 0;
+      // The most "live_bytes" has been.
+      int64_t  peak_live_bytes = 0;
+   };
+
+   /// @brief The counters for one thread. Only that thread touches them so
+   ///        they need no locking.
+   struct ThreadCounts
+   {
+      uint64_t allocations = 0;
+      uint64_t bytes       = 0;
+      int64_t  live        = 0;
+      int64_t  peak        = 0;
+   };
+
+   /// @brief The counters for one operation, shared by every thread.
+   struct SharedCounts
+   {
+      std::atomic<uint64_t> calls{0};
+      std::atomic<uint64_t> allocations{0};
+      std::atomic<uint64_t> bytes{0};
+      std::atomic<uint64_t> peak_live_bytes{0};
+   };
+   // -------------------------------------------------------------------------
+
+   // -------------------------------------------------------------------------
+   // Namespace Variables block.
+   // -------------------------------------------------------------------------
+
+   /// @brief Whether the program was built to count allocations.
+#if defined(ALLOCATION_STATS)
+   inline constexpr bool enabled = true;
+#else
+   inline constexpr bool enabled = false;
+#endif
+
+   /// @brief This thread's counters.
+   inline thread_local ThreadCounts thread_counts;
+
+   /// @brief The counters for each operation.
+   inline SharedCounts operation_counts[operation_count];
+
+   /// @brief The counters for the whole program.
+   inline std::atomic<uint64_t> total_allocations{0};
+   inline std::atomic<uint64_t> total_bytes{0};
+   inline std::atomic<int64_t>  total_live_bytes{0};
+   inline std::atomic<int64_t>  total_peak_live_bytes{0};
+   // -------------------------------------------------------------------------
+
+   // -------------------------------------------------------------------------
+   // Namespace Functions block.
+   // -------------------------------------------------------------------------
+
+   /// @brief Raise an atomic to a value if the value is bigger.
+   /// @param target The atomic.
+   /// @param value The value.
+   template<typename V>
+   inline void RaiseTo(std::atomic<V>& target, const V value)
+   {
+      V current = target.load(std::memory_order_relaxed);
+      while (current < value &&
+             !target.compare_exchange_weak(current, value,
+                                           std::memory_order_relaxed))
+      {
+      }
+   }
+
+   /// @brief Count an allocation. Called by "operator new".
+   /// @param size The bytes asked for.
+   inline void OnAllocate(const size_t size)
+   {
+      ThreadCounts& counts = thread_counts;
+      counts.allocations++;
+      counts.bytes += size;
+      counts.live  += static_cast<int64_t>(size);
+      if (counts.live > counts.peak)
+      {
+         counts.peak = counts.live;
+      }
+
+      total_allocations.fetch_add(1, std::memory_order_relaxed);
+      total_bytes.fetch_add(size, std::memory_order_relaxed);
+      const int64_t live = total_live_bytes.fetch_add(
+         static_cast<int64_t>(size), std::memory_order_relaxed) +
+         static_cast<int64_t>(size);
+      RaiseTo(total_peak_live_bytes, live);
+   }
+
+   /// @brief Count a free. Called by "operator delete".
+   /// @param size The bytes that were asked for.
+   inline void OnFree(const size_t size)
+   {
+      thread_counts.live -= static_cast<int64_t>(size);
+      total_live_bytes.fetch_sub(static_cast<int64_t>(size),
+                                 std::memory_order_relaxed);
+   }
+
+   /// @brief Get the counts for one operation.
+   /// @param operation The operation.
+   /// @return The counts over all its calls since the last "Reset".
+   inline Counts Get(const Operation operation)
+   {
+      const SharedCounts& shared =
+         operation_counts[static_cast<size_t>(operation)];
+      Counts out;
+      out.calls           = shared.calls.load();
+      out.allocations     = shared.allocations.load();
+      out.bytes           = shared.bytes.load();
+      out.peak_live_bytes = shared.peak_live_bytes.load();
+      return out;
+   }
+
+   /// @brief Get the counts for the whole program.
+   /// @return The counts since the program started. "Reset" only clears
+   ///         the peak, down to what is live now.
+   inline Totals GetTotals()
+   {
+      Totals out;
+      out.allocations     = total_allocations.load();
+      out.bytes           = total_bytes.load();
+      out.live_bytes      = total_live_bytes.load();
+      out.peak_live_bytes = total_peak_live_bytes.load();
+      return out;
+   }
+
+   /// @brief Clear the counts for every operation.
+   inline void Reset()
+   {
+      for (SharedCounts& shared : operation_counts)
+      {
+         shared.calls           = 0;
+         shared.allocations     = 0;
+         shared.bytes           = 0;
+         shared.peak_live_bytes = 0;
+      }
+      total_peak_live_bytes = total_live_bytes.load();
+   }
+
+   /// @brief Write a table of the counts for each operation.
+   /// @param out Where to write it.
+   inline void Report(std::ostream& out)
+   {
+      out << std::left << std::setw(10) << "operation" << std::right
+          << std::setw(10) << "calls" << std::setw(14) << "allocs/call"
+          << std::setw(14) << "bytes/call" << std::setw(12) << "peak live"
+          << "\n";
+      for (size_t i = 0; i < operation_count; i++)
+      {
+         const Counts counts = Get(static_cast<Operation>(i));
+         const double calls  = counts.calls == 0 ? 1.0 : counts.calls;
+         out << std::left << std::setw(10) << operation_names[i]
+             << std::right << std::setw(10) << counts.calls
+             << std::setw(14) << std::fixed << std::setprecision(2)
+             << counts.allocations / calls << std::setw(14)
+             << counts.bytes / calls << std::setw(12)
+             << counts.peak_live_bytes << "\n";
+      }
+   }
+   // -------------------------------------------------------------------------
+
+   // -------------------------------------------------------------------------
+   // Class block.
+   // -------------------------------------------------------------------------
+
+   /// @brief Puts what is allocated while it is alive down to an operation.
+   ///        Use "ALLOCATION_SCOPE" so it goes away when counting is off.
+   class Scope
+   {
+      private:
+         // The operation being counted.
+         size_t  operation;
+         // This thread's counters when the scope started.
+         uint64_t allocations;
+         uint64_t bytes;
+         int64_t  live;
+         // The peak the scope around this one had seen so far.
+         int64_t  outer_peak;
+
+      public:
+         /// @brief Start counting for an operation.
+         /// @param operation_input The operation.
+         explicit Scope(const Operation operation_input):
+            operation(static_cast<size_t>(operation_input)),
+            allocations(thread_counts.allocations),
+            bytes(thread_counts.bytes),
+            live(thread_counts.live),
+            outer_peak(thread_counts.peak)
+         {
+            // The peak is measured from here for this scope.
+            thread_counts.peak = thread_counts.live;
+         }
+
+         /// @brief Add what was counted to the operation.
+         ~Scope()
+         {
+            SharedCounts& shared = operation_counts[operation];
+            shared.calls.fetch_add(1, std::memory_order_relaxed);
+            shared.allocations.fetch_add(
+               thread_counts.allocations - allocations,
+               std::memory_order_relaxed);
+            shared.bytes.fetch_add(thread_counts.bytes - bytes,
+                                   std::memory_order_relaxed);
+            RaiseTo(shared.peak_live_bytes,
+                    static_cast<uint64_t>(thread_counts.peak - live));
+
+            // Give the scope around this one back its peak.
+            if (outer_peak > thread_counts.peak)
+            {
+               thread_counts.peak = outer_peak;
+            }
+         }
+
+         Scope(const Scope&) = delete;
+         Scope& operator=(const Scope&) = delete;
+   }; // Scope
+   // -------------------------------------------------------------------------
+} // AllocationStats
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Operator Overloads block.
+// ----------------------------------------------------------------------------
+
+#if defined(ALLOCATION_STATS)
+
+/// @brief Put the rest of the function down to an operation.
+/// @param operation The name of an "AllocationStats::Operation".
+#define ALLOCATION_SCOPE(operation)         \
+   AllocationStats::Scope allocation_scope( \
+      AllocationStats::Operation::operation)
+
+// Each block starts with its size so it can be taken off when it is freed.
+// This keeps the block after it aligned for anything.
+static_assert(sizeof(std::max_align_t) >= sizeof(size_t),
+              "The size must fit in front of the block.");
+
+/// @brief Count the allocation. The array and no-throw forms call this one
+///        so they are counted too.
+void* operator new(std::size_t size)
+{
+   AllocationStats::OnAllocate(size);
+   void* block = std::malloc(size + sizeof(std::max_align_t));
+   if (block == nullptr)
+   {
+      throw std::bad_alloc();
+   }
+   *static_cast<size_t*>(block) = size;
+   return static_cast<char*>(block) + sizeof(std::max_align_t);
+}
+
+// These are kept out of line. Once inlined GCC sees "free" on memory from
+// "new" and warns, not knowing "new" was replaced too.
+[[gnu::noinline]] void operator delete(void* memory) noexcept
+{
+   if (memory == nullptr)
+   {
+      return;
+   }
+   void* block = static_cast<char*>(memory) - sizeof(std::max_align_t);
+   AllocationStats::OnFree(*static_cast<size_t*>(block));
+   std::free(block);
+}
+
+[[gnu::noinline]] void operator delete(void* memory, std::size_t) noexcept
+{
+   ::operator delete(memory);
+}
+
+#else
+
+#define ALLOCATION_SCOPE(operation)
+
+#endif
+// ----------------------------------------------------------------------------
+
+#endif
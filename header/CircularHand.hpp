@@ -0,0 +1,131 @@
+#ifndef CIRCULARHAND_HPP
+#define CIRCULARHAND_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <cstddef>
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief A hand of cards held in a fixed ring of slots. Cards are played
+///        from the top and won cards go on the bottom, both in constant time
+///        and without touching the heap.
+/// @tparam T The type of card. Should be a packed card so it is held by value.
+/// @tparam N The amount of slots. A hand can never hold more than this.
+template<typename T, size_t N = 52>
+class CircularHand
+{
+   private:
+      // ----------------------------------------------------------------------
+      // Private Variables block.
+      // ----------------------------------------------------------------------
+
+      // The slots for the cards.
+      T      cards[N];
+      // The slot the bottom card is in.
+      size_t bottom = 0;
+      // The amount of cards in the hand.
+      size_t count  = 0;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Private Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Turn a position counted from the bottom into a slot.
+      /// @param position The position from the bottom. 0 is the bottom.
+      /// @return The slot.
+      size_t Slot(const size_t position) const
+      {
+         size_t slot = bottom + position;
+         return slot >= N ? slot - N : slot;
+      }
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Get block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Get the amount of cards in the hand.
+      /// @return The amount of cards.
+      size_t Size() const { return count; }
+
+      /// @brief Whether the hand has no cards.
+      /// @return True if it is empty. False otherwise.
+      bool Empty() const { return count == 0; }
+
+      /// @brief Get the top card. The hand must not be empty.
+      /// @return The top card.
+      const T& Top() const { return cards[Slot(count - 1)]; }
+
+      /// @brief Get a card by its position from the bottom.
+      /// @param position The position from the bottom. 0 is the bottom.
+      /// @return The card.
+      const T& At(const size_t position) const
+      {
+         return cards[Slot(position)];
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Take the top card off the hand. The hand must not be empty.
+      /// @return The card.
+      T PopTop()
+      {
+         count--;
+         return cards[Slot(count)];
+      }
+
+      /// @brief Put a card on top of the hand. The hand must not be full.
+      /// @param card The card.
+      void PushTop(const T& card)
+      {
+         cards[Slot(count)] = card;
+         count++;
+      }
+
+      /// @brief Put a card on the bottom of the hand. The hand must not be
+      ///        full.
+      /// @param card The card.
+      void PushBottom(const T& card)
+      {
+         bottom = bottom == 0 ? N - 1 : bottom - 1;
+         cards[bottom] = card;
+         count++;
+      }
+
+      /// @brief Replace the hand with a range of cards.
+      /// @tparam Iterator Any input iterator over cards.
+      /// @param first The bottom card.
+      /// @param last One past the top card.
+      template<typename Iterator>
+      void Assign(Iterator first, Iterator last)
+      {
+         Clear();
+         for (; first != last; ++first)
+         {
+            PushTop(*first);
+         }
+      }
+
+      /// @brief Take all the cards out of the hand.
+      void Clear()
+      {
+         bottom = 0;
+         count = 0;
+      }
+      // ----------------------------------------------------------------------
+}; // CircularHand
+// ----------------------------------------------------------------------------
+
+#endif
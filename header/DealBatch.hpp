@@ -0,0 +1,182 @@
+#ifndef DEALBATCH_HPP
+#define DEALBATCH_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// Utility File includes.
+// The generator, the shuffle and seeds for each deal.
+#include "Random.h"
+
+// Regular File includes.
+// Rows are turned back into decks with this.
+#include "StandardDeck.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief A lot of shuffled decks in one block of memory for simulations.
+///
+///        The batch is a matrix with one row of 52 bytes per deck. Each byte
+///        is a card id (see "PackedStandardPlayingCard::GetId") and the
+///        first byte of a row is the bottom of the deck, the same as
+///        "StandardDeck". Nothing is allocated per deck or per card, so a
+///        game kernel can read the rows straight out of "GetData".
+///
+///        Row "i" is shuffled with a "Random::Xoshiro256" seeded with
+///        "Random::StreamSeed(master_seed, i)". It is the same deck as a
+///        fresh "StandardDeck" given that seed with "SetSeed" and then
+///        "RandomizeDeck", and it does not depend on the amount of threads.
+class DealBatch
+{
+   public:
+      // ----------------------------------------------------------------------
+      // Public Variables block.
+      // ----------------------------------------------------------------------
+
+      // The amount of cards in each row.
+      static constexpr size_t row_size = 52;
+      // ----------------------------------------------------------------------
+
+   private:
+      // ----------------------------------------------------------------------
+      // Private Variables block.
+      // ----------------------------------------------------------------------
+
+      // The rows one after another.
+      std::vector<uint8_t> cards;
+      // The amount of rows.
+      size_t               rows;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Private Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Shuffle a run of rows.
+      /// @param master_seed The seed for the whole batch.
+      /// @param begin The first row.
+      /// @param end One past the last row.
+      void FillRows(const uint64_t master_seed,
+                    const size_t   begin,
+                    const size_t   end)
+      {
+         // A fresh deck in id order.
+         static constexpr std::array<uint8_t, row_size> fresh = []()
+         {
+            std::array<uint8_t, row_size> ids{};
+            for (size_t i = 0; i < row_size; i++)
+            {
+               ids[i] = static_cast<uint8_t>(i);
+            }
+            return ids;
+         }();
+
+         Random::Xoshiro256 rng;
+         for (size_t i = begin; i < end; i++)
+         {
+            uint8_t* row = GetRow(i);
+            std::memcpy(row, fresh.data(), row_size);
+            rng.Seed(Random::StreamSeed(master_seed, i));
+            Random::Shuffle(row, row + row_size, rng);
+         }
+      }
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Make room for a batch. The rows are not shuffled until
+      ///        "Fill" is called.
+      /// @param rows_input The amount of decks.
+      explicit DealBatch(const size_t rows_input = 0):
+         cards(rows_input * row_size), rows(rows_input)
+      {}
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Shuffle every row. Each thread takes one run of rows next to
+      ///        each other so no two threads write to the same cache line
+      ///        except where their runs meet.
+      /// @param master_seed The seed for the whole batch.
+      /// @param threads The amount of threads. 0 uses every core.
+      void Fill(const uint64_t master_seed, size_t threads = 0)
+      {
+         if (threads == 0)
+         {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+         }
+         // Small batches are not worth starting threads for.
+         threads = std::max<size_t>(1, std::min(threads, rows / 4096));
+
+         if (threads == 1)
+         {
+            FillRows(master_seed, 0, rows);
+            return;
+         }
+
+         std::vector<std::thread> pool;
+         pool.reserve(threads);
+         for (size_t t = 0; t < threads; t++)
+         {
+            pool.emplace_back(&DealBatch::FillRows, this, master_seed,
+                              rows * t / threads, rows * (t + 1) / threads);
+         }
+         for (auto& thread : pool)
+         {
+            thread.join();
+         }
+      }
+
+      /// @brief Make a deck from one row.
+      /// @tparam T The type of card.
+      /// @param row The index of the row.
+      /// @return The deck.
+      template<typename T>
+      StandardDeck<T> MakeDeck(const size_t row) const
+      {
+         return StandardDeck<T>::FromIds(GetRow(row), row_size);
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Get block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Get one row.
+      /// @param row The index of the row.
+      /// @return The 52 card ids of the row, bottom first.
+      uint8_t* GetRow(const size_t row) { return &cards[row * row_size]; }
+      const uint8_t* GetRow(const size_t row) const
+      {
+         return &cards[row * row_size];
+      }
+
+      /// @brief Get the whole matrix.
+      /// @return The rows one after another.
+      const uint8_t* GetData() const { return cards.data(); }
+
+      /// @brief Get the amount of rows.
+      /// @return The amount of decks.
+      size_t GetRows() const { return rows; }
+      // ----------------------------------------------------------------------
+}; // DealBatch
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,303 @@
+#ifndef DEALRANK_H
+#define DEALRANK_H
+
+// ----------------------------------------------------------------------------
+// Include block.
+// ----------------------------------------------------------------------------
+
+// Standard library include.
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <utility>
+
+// System include.
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Namespace block.
+// ----------------------------------------------------------------------------
+
+/// @brief Every order of a deck of 52 cards as a number from 0 to 52! - 1.
+///
+///        The number is the place of the order in the sorted list of all
+///        orders, where orders are compared by their card ids (suit index *
+///        13 + rank - 1) from the first card on. A fresh deck is 0. It is
+///        worked out from the Lehmer code of the order: the digit for card
+///        "i" is how many of the cards after it have a smaller id, and the
+///        digits are a number in the factorial number system.
+///
+///        52! is less than 2^226 so the number fits in 29 bytes. The bytes
+///        are stored with the most significant first, so comparing the
+///        bytes compares the numbers and sorting ranks sorts the orders.
+///
+///        Digits are put together as many at a time as fit in 64 bits, so
+///        a deck takes four big number steps and not 52. Decoding divides by
+///        the same four numbers every time, so each has a reciprocal worked
+///        out when compiling and the divisions are multiplications (Moller
+///        and Granlund, "Improved division by invariant integers").
+namespace DealRank
+{
+   // -------------------------------------------------------------------------
+   // Type Declarations block.
+   // -------------------------------------------------------------------------
+
+   /// @brief The amount of cards in a deal.
+   inline constexpr size_t deal_size = 52;
+
+   /// @brief The amount of bytes in a rank.
+   inline constexpr size_t rank_bytes = 29;
+
+   /// @brief One deal as a number.
+   using Rank = std::array<uint8_t, rank_bytes>;
+
+   /// @brief A hash for keeping ranks in unordered containers.
+   struct Hash
+   {
+      size_t operator()(const Rank& rank) const
+      {
+         return std::hash<std::string_view>()(std::string_view(
+            reinterpret_cast<const char*>(rank.data()), rank.size()));
+      }
+   };
+
+   /// @brief How the 52 digits are put into groups that fit in 64 bits.
+   ///        Digit "i" is below 52 - i.
+   struct Groups
+   {
+      // The amount of groups.
+      size_t   count = 0;
+      // The first digit of each group. The last entry is the end.
+      size_t   start[deal_size + 1] = {};
+      // The product of the digit bases in each group.
+      uint64_t radix[deal_size] = {};
+      // How far each radix is shifted so its top bit is set.
+      int      shift[deal_size] = {};
+      // The reciprocal of each shifted radix.
+      uint64_t inverse[deal_size] = {};
+      // The group each digit is in.
+      size_t   group_of[deal_size] = {};
+   };
+
+   /// @brief Work out the groups.
+   /// @return The groups.
+   constexpr Groups MakeGroups()
+   {
+      Groups groups;
+      size_t digit = 0;
+      while (digit < deal_size)
+      {
+         groups.start[groups.count] = digit;
+         uint64_t radix = 1;
+         while (digit < deal_size &&
+                radix <= UINT64_MAX / (deal_size - digit))
+         {
+            radix *= deal_size - digit;
+            digit++;
+         }
+         for (size_t i = groups.start[groups.count]; i < digit; i++)
+         {
+            groups.group_of[i] = groups.count;
+         }
+
+         int shift = 0;
+         while ((radix << shift) >> 63 == 0)
+         {
+            shift++;
+         }
+         groups.radix[groups.count]   = radix;
+         groups.shift[groups.count]   = shift;
+         groups.inverse[groups.count] = static_cast<uint64_t>(
+            ~static_cast<unsigned __int128>(0) / (radix << shift));
+         groups.count++;
+      }
+      groups.start[groups.count] = deal_size;
+      return groups;
+   }
+
+   /// @brief The groups for a deal.
+   inline constexpr Groups groups = MakeGroups();
+   // -------------------------------------------------------------------------
+
+   // -------------------------------------------------------------------------
+   // Namespace Functions block.
+   // -------------------------------------------------------------------------
+
+   /// @brief Divide a two word number by a group's radix. The high word
+   ///        must be below the shifted radix.
+   /// @param high The high word.
+   /// @param low The low word.
+   /// @param g The group.
+   /// @param remainder Where the remainder goes.
+   /// @return The quotient.
+   inline uint64_t DivideWords(const uint64_t high,
+                               const uint64_t low,
+                               const size_t   g,
+                               uint64_t&      remainder)
+   {
+      const uint64_t divisor = groups.radix[g] << groups.shift[g];
+      unsigned __int128 guess =
+         static_cast<unsigned __int128>(groups.inverse[g]) * high +
+         ((static_cast<unsigned __int128>(high) << 64) | low);
+      uint64_t quotient = static_cast<uint64_t>(guess >> 64) + 1;
+      uint64_t rest     = low - quotient * divisor;
+      if (rest > static_cast<uint64_t>(guess))
+      {
+         quotient--;
+         rest += divisor;
+      }
+      if (rest >= divisor)
+      {
+         quotient++;
+         rest -= divisor;
+      }
+      remainder = rest;
+      return quotient;
+   }
+
+   /// @brief Take the digits off the groups, the last digit first. The
+   ///        digits are known when compiling so each division by a digit's
+   ///        base is a multiplication.
+   /// @param values The groups. Each one is left at 0.
+   /// @param digits Where the digits go.
+   template<size_t... I>
+   inline void SplitDigits(uint64_t* values, uint8_t* digits,
+                           std::index_sequence<I...>)
+   {
+      constexpr size_t last = sizeof...(I) - 1;
+      ((digits[last - I] = static_cast<uint8_t>(
+           values[groups.group_of[last - I]] % (deal_size - (last - I))),
+        values[groups.group_of[last - I]] /= deal_size - (last - I)), ...);
+   }
+
+   /// @brief Turn an order of the cards into its rank.
+   /// @param ids The 52 card ids, which must each be there once.
+   /// @param out Where the rank goes.
+   /// @return False if the ids are not each card once. "out" is then left
+   ///         alone.
+   inline bool Encode(const uint8_t* ids, Rank& out)
+   {
+      // The rank as four 64 bit words, the lowest first.
+      uint64_t words[4] = {0, 0, 0, 0};
+      // The cards not yet seen.
+      uint64_t left = (uint64_t(1) << deal_size) - 1;
+
+      for (size_t g = 0; g < groups.count; g++)
+      {
+         uint64_t value = 0;
+         for (size_t i = groups.start[g]; i < groups.start[g + 1]; i++)
+         {
+            const uint64_t bit = uint64_t(1) << (ids[i] & 63);
+            if (ids[i] >= deal_size || (left & bit) == 0)
+            {
+               return false;
+            }
+            const uint64_t below = static_cast<uint64_t>(
+               __builtin_popcountll(left & (bit - 1)));
+            left ^= bit;
+            value = value * (deal_size - i) + below;
+         }
+
+         // words = words * radix + value.
+         unsigned __int128 carry = value;
+         for (uint64_t& word : words)
+         {
+            carry += static_cast<unsigned __int128>(word) * groups.radix[g];
+            word   = static_cast<uint64_t>(carry);
+            carry >>= 64;
+         }
+      }
+
+      for (size_t i = 0; i < rank_bytes; i++)
+      {
+         const size_t byte = rank_bytes - 1 - i;
+         out[i] = static_cast<uint8_t>(words[byte / 8] >> (byte % 8 * 8));
+      }
+      return true;
+   }
+
+   /// @brief Turn a rank back into the order of the cards.
+   /// @param rank The rank. It must be below 52!.
+   /// @param ids Where the 52 card ids go.
+   /// @return False if the rank is 52! or more. "ids" is then left alone.
+   inline bool Decode(const Rank& rank, uint8_t* ids)
+   {
+      // One word more than the rank needs so it can be shifted for the
+      // division.
+      uint64_t words[5] = {0, 0, 0, 0, 0};
+      for (size_t i = 0; i < rank_bytes; i++)
+      {
+         const size_t byte = rank_bytes - 1 - i;
+         words[byte / 8] |= uint64_t(rank[i]) << (byte % 8 * 8);
+      }
+
+      // Take the groups off the bottom of the number, the last one first.
+      uint64_t values[deal_size];
+      for (size_t g = groups.count; g-- > 0;)
+      {
+         // Shift the number as far as the radix so the quotient is the
+         // same and the remainder is shifted too.
+         const int shift = groups.shift[g];
+         if (shift > 0)
+         {
+            for (size_t w = 4; w > 0; w--)
+            {
+               words[w] = (words[w] << shift) | (words[w - 1] >> (64 - shift));
+            }
+            words[0] <<= shift;
+         }
+
+         uint64_t remainder = 0;
+         for (size_t w = 5; w-- > 0;)
+         {
+            words[w] = DivideWords(remainder, words[w], g, remainder);
+         }
+         values[g] = remainder >> shift;
+      }
+      if ((words[0] | words[1] | words[2] | words[3] | words[4]) != 0)
+      {
+         return false;
+      }
+
+      // Split the groups into digits and place the cards.
+      uint8_t digits[deal_size];
+      SplitDigits(values, digits, std::make_index_sequence<deal_size>());
+
+      // Digit "i" is which of the cards not yet placed goes next.
+#if defined(__BMI2__)
+      // One bit for each card not yet placed. "pdep" puts the digit's bit
+      // on the digit-th card left in a single instruction.
+      uint64_t left = (uint64_t(1) << deal_size) - 1;
+      for (size_t i = 0; i < deal_size; i++)
+      {
+         const uint64_t bit = _pdep_u64(uint64_t(1) << digits[i], left);
+         left  ^= bit;
+         ids[i] = static_cast<uint8_t>(__builtin_ctzll(bit));
+      }
+#else
+      uint8_t left[deal_size];
+      for (size_t i = 0; i < deal_size; i++)
+      {
+         left[i] = static_cast<uint8_t>(i);
+      }
+      for (size_t i = 0; i < deal_size; i++)
+      {
+         const size_t digit = digits[i];
+         ids[i] = left[digit];
+         std::memmove(left + digit, left + digit + 1,
+                      deal_size - 1 - i - digit);
+      }
+#endif
+      return true;
+   }
+   // -------------------------------------------------------------------------
+} // DealRank
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,298 @@
+#ifndef DIFFRENDERER_HPP
+#define DIFFRENDERER_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// System includes.
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+// Regular File includes.
+// The frames are built and sent with this.
+#include "FrameBuffer.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief Draws frames to the terminal by only sending what changed.
+///
+///        A frame is built as plain rows ending in new lines. The last frame
+///        that was drawn is kept, and each new one is compared with it one
+///        cell (one UTF-8 character) at a time. Only the changed spans of
+///        each row are sent, each after a cursor move. Small runs of cells
+///        that did not change are sent anyway when that is cheaper than
+///        another cursor move. After the frame the cursor is left at the
+///        start of the row below it and everything under it is erased, so
+///        prompts printed after a frame are cleaned up by the next one.
+///
+///        The whole screen is cleared and drawn instead when there is no
+///        last frame, when standard out is not a terminal, or when the frame
+///        and the rows kept for prompts do not fit the terminal. Output that
+///        scrolls the terminal would move what is on the screen away from
+///        where the last frame says it is.
+class DiffRenderer
+{
+   private:
+      // ----------------------------------------------------------------------
+      // Private Variables block.
+      // ----------------------------------------------------------------------
+
+      // Cells that did not change but are closer together than this are sent
+      // with the changes around them. A cursor move is 6 to 8 bytes.
+      static constexpr size_t max_gap = 4;
+
+      // The frame being built.
+      FrameBuffer next;
+      // The bytes sent to the terminal.
+      FrameBuffer out;
+      // The frame on the screen, as plain rows.
+      std::string shown;
+      // The rows under the frame kept for prompts and messages.
+      size_t      reserved_rows;
+      // Whether the screen is known to look like "shown".
+      bool        valid = false;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Private Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Get how many bytes the UTF-8 character starting with a byte
+      ///        takes.
+      /// @param lead The first byte of the character.
+      /// @return The length 1 to 4.
+      static size_t CellBytes(const unsigned char lead)
+      {
+         if (lead < 0xc0)
+         {
+            return 1;
+         }
+         else if (lead < 0xe0)
+         {
+            return 2;
+         }
+         else if (lead < 0xf0)
+         {
+            return 3;
+         }
+         return 4;
+      }
+
+      /// @brief Take the next row off the front of a frame.
+      /// @param frame What is left of the frame. The row is removed.
+      /// @return The row without its new line. Empty if there are no rows.
+      static std::string_view NextRow(std::string_view& frame)
+      {
+         size_t end = frame.find('\n');
+         if (end == std::string_view::npos)
+         {
+            std::string_view row = frame;
+            frame = {};
+            return row;
+         }
+         std::string_view row = frame.substr(0, end);
+         frame.remove_prefix(end + 1);
+         return row;
+      }
+
+      /// @brief Count the rows in a frame.
+      /// @param frame The frame.
+      /// @return The amount of rows.
+      static size_t CountRows(const std::string_view frame)
+      {
+         size_t rows = 0;
+         for (const char c : frame)
+         {
+            rows += c == '\n';
+         }
+         if (!frame.empty() && frame.back() != '\n')
+         {
+            rows++;
+         }
+         return rows;
+      }
+
+      /// @brief Get the height of the terminal.
+      /// @return The amount of rows or 0 when standard out is not a terminal.
+      static size_t TerminalRows()
+      {
+         winsize size{};
+         if (!isatty(STDOUT_FILENO) ||
+             ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) != 0)
+         {
+            return 0;
+         }
+         return size.ws_row;
+      }
+
+      /// @brief Add the changes to one row to "out".
+      /// @param row The row index.
+      /// @param old_row What the row was.
+      /// @param new_row What the row is now.
+      void DiffRow(const size_t           row,
+                   const std::string_view old_row,
+                   const std::string_view new_row)
+      {
+         size_t old_byte = 0;
+         size_t new_byte = 0;
+         size_t column   = 0;
+
+         // The span of changed cells waiting to be sent.
+         bool   open       = false;
+         size_t span_col   = 0;
+         size_t span_byte  = 0;
+         size_t span_end   = 0;
+         size_t equal_run  = 0;
+
+         while (new_byte < new_row.size())
+         {
+            size_t new_len = CellBytes(new_row[new_byte]);
+            bool   same    = false;
+            if (old_byte < old_row.size())
+            {
+               size_t old_len = CellBytes(old_row[old_byte]);
+               same = old_row.substr(old_byte, old_len) ==
+                      new_row.substr(new_byte, new_len);
+               old_byte += old_len;
+            }
+
+            if (!same)
+            {
+               if (!open)
+               {
+                  open      = true;
+                  span_col  = column;
+                  span_byte = new_byte;
+               }
+               span_end  = new_byte + new_len;
+               equal_run = 0;
+            }
+            else if (open && ++equal_run > max_gap)
+            {
+               out.GotoRC(row, span_col);
+               out.Append(new_row.substr(span_byte, span_end - span_byte));
+               open = false;
+            }
+
+            new_byte += new_len;
+            column++;
+         }
+
+         if (open)
+         {
+            out.GotoRC(row, span_col);
+            out.Append(new_row.substr(span_byte, span_end - span_byte));
+         }
+
+         // If the row got shorter erase the rest of it.
+         if (old_byte < old_row.size())
+         {
+            out.GotoRC(row, column);
+            out.Append("\x1b[K");
+         }
+      }
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Make a renderer.
+      /// @param reserved_rows_input The rows to keep free under the frame for
+      ///                            prompts and messages.
+      explicit DiffRenderer(const size_t reserved_rows_input = 8):
+         reserved_rows(reserved_rows_input)
+      {}
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Start a new frame.
+      /// @param rows The amount of rows the frame will have.
+      /// @param row_bytes About how many bytes each row will take.
+      /// @return The frame to add the rows to. Each row ends with "EndRow".
+      FrameBuffer& Begin(const size_t rows, const size_t row_bytes)
+      {
+         next.Begin(rows, row_bytes);
+         return next;
+      }
+
+      /// @brief Forget what is on the screen so the next frame is drawn in
+      ///        full. Call this after printing anything that may have
+      ///        scrolled the terminal.
+      void Invalidate() { valid = false; }
+
+      /// @brief Work out the bytes that draw the frame over the last one
+      ///        without sending them. "Present" uses this.
+      /// @param terminal_rows The height of the terminal. 0 if it is not a
+      ///                      terminal.
+      void Render(const size_t terminal_rows)
+      {
+         const std::string_view frame = next.GetView();
+         const size_t rows = CountRows(frame);
+         const bool   fits = rows + reserved_rows <= terminal_rows;
+
+         out.Begin(rows, 16);
+         if (!valid || !fits)
+         {
+            // Draw the whole thing.
+            out.ClearScreen();
+            out.Append(frame);
+         }
+         else
+         {
+            const size_t     shown_rows = CountRows(shown);
+            std::string_view old_rest   = shown;
+            std::string_view new_rest   = frame;
+            for (size_t row = 0; row < rows; row++)
+            {
+               if (row < shown_rows)
+               {
+                  DiffRow(row, NextRow(old_rest), NextRow(new_rest));
+               }
+               else
+               {
+                  // Rows under the last frame may hold a prompt, so they are
+                  // drawn in full and the rest of the line is erased.
+                  out.GotoRC(row, 0);
+                  out.Append(NextRow(new_rest));
+                  out.Append("\x1b[K");
+               }
+            }
+
+            // Leave the cursor under the frame and erase what is below.
+            out.GotoRC(rows, 0);
+            out.Append("\x1b[J");
+         }
+
+         shown.assign(frame);
+         valid = fits;
+      }
+
+      /// @brief Send the frame to the terminal with a single write.
+      void Present()
+      {
+         Render(TerminalRows());
+         out.Write();
+      }
+
+      /// @brief Get the bytes sent for the last frame.
+      /// @return The bytes.
+      std::string_view GetLastOutput() const { return out.GetView(); }
+      // ----------------------------------------------------------------------
+}; // DiffRenderer
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef FRAMEBUFFER_HPP
+#define FRAMEBUFFER_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <cerrno>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// System includes.
+#include <unistd.h>
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief One whole frame of terminal output built up in a single buffer.
+///        The buffer is kept between frames so once it has grown to the size
+///        of a frame drawing allocates nothing, and the frame is sent to the
+///        terminal with one write.
+class FrameBuffer
+{
+   private:
+      // ----------------------------------------------------------------------
+      // Private Variables block.
+      // ----------------------------------------------------------------------
+
+      // The bytes of the frame. Clearing it keeps its memory.
+      std::string bytes;
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Start a new frame. The old one is thrown away but its memory
+      ///        is kept.
+      /// @param rows The amount of rows the frame will have.
+      /// @param row_bytes About how many bytes each row will take.
+      void Begin(const size_t rows, const size_t row_bytes)
+      {
+         bytes.clear();
+         bytes.reserve(rows * (row_bytes + 1));
+      }
+
+      /// @brief Add text to the frame.
+      /// @param text The text.
+      void Append(const std::string_view text) { bytes.append(text); }
+
+      /// @brief Add the same character a few times.
+      /// @param amount How many times.
+      /// @param character The character.
+      void Append(const size_t amount, const char character)
+      {
+         bytes.append(amount, character);
+      }
+
+      /// @brief Add a number written out in decimal.
+      /// @param number The number.
+      void AppendNumber(size_t number)
+      {
+         char   digits[20];
+         size_t count = 0;
+         do
+         {
+            digits[count++] = static_cast<char>('0' + number % 10);
+            number /= 10;
+         } while (number != 0);
+
+         while (count > 0)
+         {
+            bytes.push_back(digits[--count]);
+         }
+      }
+
+      /// @brief End the current row.
+      void EndRow() { bytes.push_back('\n'); }
+
+      /// @brief Clear the terminal and go to the top left corner. These are
+      ///        the same bytes as "Ansi_t::clrscr" then "Ansi_t::gotoRC(0,0)".
+      void ClearScreen() { Append("\x1b[H\x1b[2J\x1b[1;1H"); }
+
+      /// @brief Move the cursor. Same as "Ansi_t::gotoRC".
+      /// @param row The row, 0 based.
+      /// @param column The column, 0 based.
+      void GotoRC(const size_t row, const size_t column)
+      {
+         Append("\x1b[");
+         AppendNumber(row + 1);
+         bytes.push_back(';');
+         AppendNumber(column + 1);
+         bytes.push_back('H');
+      }
+
+      /// @brief Send the frame to standard out with a single write. Anything
+      ///        still waiting in "std::cout" goes first so the order is kept.
+      void Write()
+      {
+         std::cout.flush();
+
+         const char* data = bytes.data();
+         size_t      left = bytes.size();
+         while (left > 0)
+         {
+            ssize_t written = ::write(STDOUT_FILENO, data, left);
+            if (written < 0)
+            {
+               if (errno == EINTR)
+               {
+                  continue;
+               }
+               return;
+            }
+            data += written;
+            left -= static_cast<size_t>(written);
+         }
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Get block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Get the frame built so far.
+      /// @return The bytes of the frame.
+      std::string_view GetView() const { return bytes; }
+
+      /// @brief Get how many bytes the buffer can hold before it grows.
+      /// @return The capacity.
+      size_t GetCapacity() const { return bytes.capacity(); }
+      // ----------------------------------------------------------------------
+}; // FrameBuffer
+// ----------------------------------------------------------------------------
+
+#endif
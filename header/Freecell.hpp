@@ -8,6 +8,8 @@
 // Utility File includes.
 // This is my own home grown utilities for this specific project.
 #include "Util.h"
+// Numbered deals.
+#include "MicrosoftDeals.h"
 
 // Regular File includes.
 // This is the header file for the "Solitaire" namespace and class.
@@ -28,7 +30,7 @@ namespace Solitaire
 // ----------------------------------------------------------------------------
 
 /// @brief This is the class implementation for a Freecell solitaire game.
-class Freecell: public Solitaire<StandardPlayingCard>
+class Freecell: public Solitaire<PackedStandardPlayingCard>
 {
    private:
       // ----------------------------------------------------------------------
@@ -59,11 +61,11 @@ class Freecell: public Solitaire<StandardPlayingCard>
                                         const size_t pile_to,
                                         const size_t amount) const
       {
-         return board[pile_from - 1][board[pile_from - 1].size() - amount]
-                   ->GetColor() != board[pile_to - 1].back()->GetColor() &&
-                board[pile_to - 1].back()->GetRank() == 
-                   board[pile_from - 1][board[pile_from - 1].size() 
-                   - amount]->GetRank() + 1;
+         const PackedStandardPlayingCard& moving =
+            board[pile_from - 1][board[pile_from - 1].size() - amount];
+         const PackedStandardPlayingCard& onto = board[pile_to - 1].back();
+         return moving.GetColorType() != onto.GetColorType() &&
+                onto.GetRank() == moving.GetRank() + 1;
       }
 
       /// @brief This function checks to make sure that the amount we are
@@ -133,14 +135,28 @@ class Freecell: public Solitaire<StandardPlayingCard>
       {
          // First randomize the deck as it starts as an "out of the box" deck.
          deck.RandomizeDeck();
+         // Then deal it out.
+         DealDeck();
+      } // Deal
+
+      /// @brief Deal the deck as it is onto a fresh board. The top of the
+      ///        deck goes on the first column.
+      void DealDeck()
+      {
+         ALLOCATION_SCOPE(deal);
+
+         // Start from nothing so we can deal more than once.
+         board.clear();
+         stacks.clear();
+         history.clear();
 
          // Initialize the free piles.
-         free = Pile<StandardPlayingCard>();
+         free = Pile<PackedStandardPlayingCard>();
          // Initialize the stacks.
          for (size_t i = 0; i < 4; i++)
          {
-            Pile<StandardPlayingCard> temp = 
-               Pile<StandardPlayingCard>();
+            Pile<PackedStandardPlayingCard> temp = 
+               Pile<PackedStandardPlayingCard>();
             stacks.push_back(std::move(temp));
          }
 
@@ -161,7 +177,7 @@ class Freecell: public Solitaire<StandardPlayingCard>
                board[i % 8].push_back(std::move(deck.DrawOne()));
             }
          }
-      } // Deal
+      } // DealDeck
 
       /// @brief This function will automatically move cards from the free
       ///        slots to the stacks.
@@ -175,7 +191,7 @@ class Freecell: public Solitaire<StandardPlayingCard>
          // and if cards were moved return true.
          for (size_t i = 0; i < size + 1 && !free.empty(); i++)
          {
-            MoveFreeToStack(free[i]->GetSuit(), i + 1, true);
+            MoveFreeToStack(free[i]->GetSuitType(), i + 1, true);
             return free.size() != size;
          }
          // Otherwise as stated we return false.
@@ -191,6 +207,8 @@ class Freecell: public Solitaire<StandardPlayingCard>
                             const size_t pile_to,
                             const size_t amount = 1)
       {
+         TRACE_SCOPE("Freecell::MoveBoardToBoard");
+
          // Check if we can move the cards.
          // Check the bounds of both indices.
          // Check if the pile and amount are in descending order.
@@ -215,23 +233,10 @@ class Freecell: public Solitaire<StandardPlayingCard>
                                      pile_to,
                                      amount)))
          {
-            // Define the temp variable.
-            Pile<StandardPlayingCard> temp;
-            // Reserve the amount.
-            temp.reserve(amount);
-
-            // Move the cards to 'temp' and pop the blank memory slot.
-            for (size_t i = amount; 0 < i; i--)
-            {
-               temp.push_back(std::move(board[pile_from - 1].back()));
-               board[pile_from - 1].pop_back();
-            }
-            // Then push it to the new pile and pop the blank memory slots.
-            for (size_t i = amount; 0 < i; i--)
-            {
-               board[pile_to - 1].push_back(std::move(temp.back()));
-               temp.pop_back();
-            }
+            // Move the cards.
+            MakeMove({MovePlace::column, uint8_t(pile_from - 1),
+                      MovePlace::column, uint8_t(pile_to - 1),
+                      uint8_t(amount)});
          }
          else
          {
@@ -249,9 +254,9 @@ class Freecell: public Solitaire<StandardPlayingCard>
       ///                  the car from.
       /// @param stack This is the stack that we will move the card to.
       /// @param aut This will just not output error messages if it is true.
-      void MoveBoardToStack(const size_t      pile_from,
-                            const std::string stack,
-                            bool              aut)
+      void MoveBoardToStack(const size_t pile_from,
+                            const Suit   stack,
+                            bool         aut)
       {
          // This just gives the index of the stack vector.
          size_t stack_suit = GetStackSuit(stack);
@@ -259,18 +264,16 @@ class Freecell: public Solitaire<StandardPlayingCard>
          // Check first if the card can be moved to that stack.
          // Check then if the stack is empty and the card is an ace.
          // Or check to see if the card has a rank one higher.
-         if ((board[pile_from - 1].back()->GetSuit() == stack) &&
+         if ((board[pile_from - 1].back()->GetSuitType() == stack) &&
              ((stacks[stack_suit].empty() && 
                board[pile_from - 1].back()->GetRank() == 1) ||
               (!stacks[stack_suit].empty() &&
                stacks[stack_suit].back()->GetRank() == 
                board[pile_from - 1].back()->GetRank() - 1)))
          {
-            // If we passed move the card to the stack and pop 
-            // the empty memory slot on the board.
-            stacks[stack_suit].push_back(
-                               std::move(board[pile_from - 1].back()));
-            board[pile_from - 1].pop_back();
+            // If we passed move the card to the stack.
+            MakeMove({MovePlace::column, uint8_t(pile_from - 1),
+                      MovePlace::foundation, uint8_t(stack_suit), 1});
          }
          else if (!aut)
          {
@@ -290,9 +293,9 @@ class Freecell: public Solitaire<StandardPlayingCard>
          if (!board[pile_from - 1].empty() &&
              free.size() < 4)
          {
-            // If we passed move the card and pop the memory slot.
-            free.push_back(std::move(board[pile_from - 1].back()));
-            board[pile_from - 1].pop_back();
+            // If we passed move the card.
+            MakeMove({MovePlace::column, uint8_t(pile_from - 1),
+                      MovePlace::cell, uint8_t(free.size()), 1});
          }
          else
          {
@@ -316,14 +319,14 @@ class Freecell: public Solitaire<StandardPlayingCard>
          if (!free.empty() &&
              1 <= index && index <= free.size() &&
              (board[pile_to - 1].empty() ||
-              (free[index - 1]->GetColor() != 
-                  board[pile_to - 1].back()->GetColor() &&
+              (free[index - 1]->GetColorType() != 
+                  board[pile_to - 1].back()->GetColorType() &&
                free[index - 1]->GetRank() + 1 == 
                   board[pile_to - 1].back()->GetRank())))
          {
-            // If we passed move the card and pop the memory slot.
-            board[pile_to - 1].push_back(std::move(free[index - 1]));
-            free.erase(free.begin() + (index - 1));
+            // If we passed move the card.
+            MakeMove({MovePlace::cell, uint8_t(index - 1),
+                      MovePlace::column, uint8_t(pile_to - 1), 1});
          }
          else
          {
@@ -338,9 +341,9 @@ class Freecell: public Solitaire<StandardPlayingCard>
       /// @param stack This is the stack that we will move the card to.
       /// @param index The index of the free slot we would like to move.
       /// @param aut This will just not output error messages if it is true.
-      void MoveFreeToStack(const std::string stack,
-                           const size_t      index,
-                           bool              aut)
+      void MoveFreeToStack(const Suit   stack,
+                           const size_t index,
+                           bool         aut)
       {
          // This just gives the index of the stack vector.
          size_t stack_suit = GetStackSuit(stack);
@@ -351,12 +354,12 @@ class Freecell: public Solitaire<StandardPlayingCard>
          // Then check if we can actually move the card there.
          if (!free.empty() &&
              1 <= index && index <= free.size() &&
-             free[index - 1]->GetSuit() == stack &&
+             free[index - 1]->GetSuitType() == stack &&
              CheckCardToStack(stack_suit, index))
          {
-            // If we passed move the card and pop the memory slot.
-            stacks[stack_suit].push_back(std::move(free[index - 1]));
-            free.erase(free.begin() + (index - 1));
+            // If we passed move the card.
+            MakeMove({MovePlace::cell, uint8_t(index - 1),
+                      MovePlace::foundation, uint8_t(stack_suit), 1});
          }
          else if (!aut)
          {
@@ -370,8 +373,8 @@ class Freecell: public Solitaire<StandardPlayingCard>
       /// @param pile_to This is the index of the board slot we will move the
       ///                card to.
       /// @param stack This is the stack that we will move the card to.
-      void MoveStackToBoard(const size_t      pile_to, 
-                            const std::string stack)
+      void MoveStackToBoard(const size_t pile_to, 
+                            const Suit   stack)
       {
          // This just gives the index of the stack vector.
          size_t stack_suit = GetStackSuit(stack);
@@ -385,12 +388,12 @@ class Freecell: public Solitaire<StandardPlayingCard>
              CheckPileBounds(pile_to) &&
              (board[pile_to - 1].back()->GetRank() == 
                stacks[stack_suit].back()->GetRank() + 1) &&
-             (board[pile_to - 1].back()->GetColor() != 
-               stacks[stack_suit].back()->GetColor()))
+             (board[pile_to - 1].back()->GetColorType() != 
+               stacks[stack_suit].back()->GetColorType()))
          {
-            // If we passed move the card and pop the memory slot.
-            board[pile_to - 1].push_back(std::move(stacks[stack_suit].back()));
-            stacks[stack_suit].pop_back();
+            // If we passed move the card.
+            MakeMove({MovePlace::foundation, uint8_t(stack_suit),
+                      MovePlace::column, uint8_t(pile_to - 1), 1});
          }
          else
          {
@@ -403,7 +406,7 @@ class Freecell: public Solitaire<StandardPlayingCard>
 
       /// @brief Move cards from the stacks to the free slots.
       /// @param stack This is the stack that we will move the card to.
-      void MoveStackToFree(const std::string stack)
+      void MoveStackToFree(const Suit stack)
       {
          // This just gives the index of the stack vector.
          size_t stack_suit = GetStackSuit(stack);
@@ -413,9 +416,9 @@ class Freecell: public Solitaire<StandardPlayingCard>
          if (!stacks[stack_suit].empty() &&
              free.size() < 4)
          {
-            // If we passed move the card and pop the memory slot.
-            free.push_back(std::move(stacks[stack_suit].back()));
-            stacks[stack_suit].pop_back();
+            // If we passed move the card.
+            MakeMove({MovePlace::foundation, uint8_t(stack_suit),
+                      MovePlace::cell, uint8_t(free.size()), 1});
          }
          else
          {
@@ -444,6 +447,7 @@ class Freecell: public Solitaire<StandardPlayingCard>
             std::cout << "Please enter where you would"
                      << " like to move cards from.\n"
                      << "Type \"free\", \"stack\", a number 1 to 7,"
+                     << " \"undo\" to take back a move,"
                      << " \"stop\" to reset your inputs, "
                      << "or \"exit\" to quit/give-up. " ;
             std::cin >> input1;
@@ -453,7 +457,8 @@ class Freecell: public Solitaire<StandardPlayingCard>
                 input1 != "4" && input1 != "5" && input1 != "6" &&
                 input1 != "7" && input1 != "exit" && input1 != "e" &&
                 input1 != "stop" && input1 != "s" &&
-                input1 != "auto" && input1 != "a");
+                input1 != "auto" && input1 != "a" &&
+                input1 != "undo" && input1 != "u");
          
          // If it is "auto" then call the auto move functions.
          if (input1 == "auto" || input1 == "a")
@@ -604,12 +609,24 @@ class Freecell: public Solitaire<StandardPlayingCard>
          std::string input3 = inputs[2];
 
          // This just goes through the inputs and calls the correct function.
-         if (input1 == "free")
+         if (input1 == "undo" || input1 == "u")
+         {
+            if (!UndoLastMove())
+            {
+               std::cout << "There are no moves to undo!\n";
+               std::cin.get();
+            }
+         }
+         else if (input1 == "auto" || input1 == "a")
+         {
+            // The automatic moves were already made when it was typed.
+         }
+         else if (input1 == "free")
          {
             if (input3 == "stack" && !free.empty())
             {
                size_t index = Util::CStrToInt(input2);
-               MoveFreeToStack(free.back()->GetSuit(), index, false);
+               MoveFreeToStack(free.back()->GetSuitType(), index, false);
             }
             else if (!free.empty())
             {
@@ -629,7 +646,7 @@ class Freecell: public Solitaire<StandardPlayingCard>
             if (!stacks[stack_suit].empty())
             {
                size_t pile = Util::CStrToInt(input3);
-               MoveStackToBoard(pile,input2);
+               MoveStackToBoard(pile, static_cast<Suit>(stack_suit));
             }
             else
             {
@@ -643,7 +660,7 @@ class Freecell: public Solitaire<StandardPlayingCard>
             if (input2 == "stack" && !board[pile1 - 1].empty())
             {
                MoveBoardToStack(pile1, 
-                                board[pile1 - 1].back()->GetSuit(), 
+                                board[pile1 - 1].back()->GetSuitType(), 
                                 false);
             }
             else if (input2 == "free" && !board[pile1 - 1].empty())
@@ -668,79 +685,51 @@ class Freecell: public Solitaire<StandardPlayingCard>
       // Graphics!!
       // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - 
 
-      /// @brief This function gets the top row which is particular to the
-      ///        game being played. 
-      /// @return Returns the string vector of the graphics all from the top
-      ///         row of cards.
-      std::vector<std::string> TopRowGraphic()
+      /// @brief This function adds the top row which is particular to the
+      ///        game being played to the frame.
+      /// @param frame The frame to add the rows to.
+      void TopRowGraphic(FrameBuffer& frame)
       {
-         // Initialize output.
-         std::vector<std::string> out;
-
-         // Add the free card graphics.
-         for (size_t i = 0; i < free.size(); i++)
+         for (size_t row = 0; row < CardGraphicsAndInfo::graphic_rows; row++)
          {
-            // The first one we can just set 'out'.
-            // Else we will append some space and then the card graphic.
-            if (i == 0)
-            {
-               out = free[i]->GetGraphic();
-            }
-            else
+            // Add the free card graphics with some space between them.
+            for (size_t i = 0; i < free.size(); i++)
             {
-               for (size_t j = 0; j < out.size(); j++)
+               if (i != 0)
                {
-                  out[j].append("  ");
-                  out[j].append(free[i]->GetGraphic().at(j));
+                  frame.Append("  ");
                }
+               frame.Append(free[i]->GetGraphic()[row]);
             }
-         }
-
-         // If at this point 'out' is still empty we need
-         // to initialize it.
-         if (out.empty())
-         {
-            out = {"","","","","","","","",""};
-         }
 
-         // For the empty free slots we need to print the empty slot.
-         for (size_t i = 4; i > free.size(); i--)
-         {
-            // Now start inputting the rows.
-            for (size_t j = 0; j < out.size(); j++)
+            // For the empty free slots we need to print the empty slot.
+            for (size_t i = free.size(); i < 4; i++)
             {
-               // First append a space.
-               if (out[j] != "")
+               // First append a space unless this is the start of the row.
+               if (i != 0)
                {
-                  out[j].append("  ");
+                  frame.Append("  ");
                }
 
                // Then if it is the first or last the add the border.
                // Else do the internal border.
-               if (j == 0 || j == out.size() - 1)
+               if (row == 0 || row == CardGraphicsAndInfo::graphic_rows - 1)
                { 
-                  out[j].append("+-----------+");
+                  frame.Append("+-----------+");
                }
                else
                {
-                  out[j].append("|           |");
+                  frame.Append("|           |");
                }
             }
-         }
-
-         // At the end we need to add another space.
-         for (size_t j = 0; j < out.size(); j++)
-         {
-            out[j].append("  ");
-         }
 
-         // Add the stack graphics.
-         AddStackGraphics(out, 0);
-         AddStackGraphics(out, 1);
-         AddStackGraphics(out, 2);
-         AddStackGraphics(out, 3);
+            // At the end we need to add another space.
+            frame.Append("  ");
 
-         return out;
+            // Add the stack graphics.
+            AddStackGraphics(frame, row);
+            frame.EndRow();
+         }
       } // TopRowGraphic
       // ----------------------------------------------------------------------
    
@@ -749,6 +738,66 @@ class Freecell: public Solitaire<StandardPlayingCard>
       // Public Function block.
       // ----------------------------------------------------------------------
 
+      /// @brief Deal a numbered deal. The same number is always the same
+      ///        deal, and it matches the old Microsoft Freecell deals.
+      /// @param deal The deal number.
+      void DealByNumber(const uint32_t deal)
+      {
+         // Get the cards in the order they are dealt.
+         uint8_t order[52];
+         MicrosoftDeals::Deal(deal, order);
+
+         // Cards are drawn from the back so put them in backwards.
+         Pile<PackedStandardPlayingCard> cards;
+         for (size_t i = 52; i > 0; i--)
+         {
+            cards.push_back(PackedStandardPlayingCard::FromId(order[i - 1]));
+         }
+         deck.SetDeck(cards);
+         DealDeck();
+      }
+
+      /// @brief Make a move straight on the piles without any checks or
+      ///        strings. Cells are kept packed, so a card leaving a cell
+      ///        shifts the ones after it down and a card going to a cell
+      ///        always goes after the others.
+      /// @param move The move. It must be legal.
+      void ApplyMove(Move& move)
+      {
+         Pile<PackedStandardPlayingCard>& from =
+            GetMovePile(move.from, move.from_index);
+         Pile<PackedStandardPlayingCard>& to =
+            GetMovePile(move.to, move.to_index);
+         if (move.from == MovePlace::cell)
+         {
+            to.push_back(std::move(from[move.from_index]));
+            from.erase(from.begin() + move.from_index);
+         }
+         else
+         {
+            MoveCards(from, to, move.amount);
+         }
+      }
+
+      /// @brief Take back a move that was just made.
+      /// @param move The move.
+      void UndoMove(const Move& move)
+      {
+         Pile<PackedStandardPlayingCard>& from =
+            GetMovePile(move.from, move.from_index);
+         Pile<PackedStandardPlayingCard>& to =
+            GetMovePile(move.to, move.to_index);
+         if (move.from == MovePlace::cell)
+         {
+            from.insert(from.begin() + move.from_index, std::move(to.back()));
+            to.pop_back();
+         }
+         else
+         {
+            MoveCards(to, from, move.amount);
+         }
+      }
+
       // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - 
       // Game!! Must be at the end since it has everything.
       // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - 
@@ -759,18 +808,27 @@ class Freecell: public Solitaire<StandardPlayingCard>
          // Introduction statement.
          std::cout << "This is Freecell Solitaire!!\n";
 
-         // Whether to start the game or not.
+         // Whether to start the game or not. A number picks that deal.
          std::string start;
          do
          {
-            std::cout << "Type \"start\" to start. ";
+            std::cout << "Type \"start\" to start or a deal number to play"
+                      << " that deal. ";
             std::cin >> start;
          } 
          while (start != "start" && 
-                start != "s");
+                start != "s" &&
+                start.find_first_not_of("0123456789") != std::string::npos);
 
          // Deal the cards.
-         Deal();
+         if (start == "start" || start == "s")
+         {
+            Deal();
+         }
+         else
+         {
+            DealByNumber(std::strtoul(start.c_str(), nullptr, 10));
+         }
 
          // This is the bread and butter.
          // First we print the screen then checck the win condition
@@ -0,0 +1,1207 @@
+#ifndef FREECELLSOLVER_HPP
+#define FREECELLSOLVER_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Utility File includes.
+// The mixer used to make the hash keys.
+#include "Random.h"
+
+// Regular File includes.
+// This is the header file for the "Freecell" class.
+#include "Freecell.hpp"
+// The moves shared by every solitaire game.
+#include "Move.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Namespace block.
+// ----------------------------------------------------------------------------
+
+/// @brief Adding a solver to the solitaire family of games.
+namespace Solitaire
+{
+// ----------------------------------------------------------------------------
+// Type Declarations block.
+// ----------------------------------------------------------------------------
+
+/// @brief How a solve finished.
+enum class FreecellSolveStatus
+{
+   // A solution was found.
+   solved,
+   // Every position was tried and none of them win.
+   unsolvable,
+   // The node budget ran out first.
+   gave_up
+};
+
+/// @brief What a solve found.
+struct FreecellSolveResult
+{
+   FreecellSolveStatus       status = FreecellSolveStatus::gave_up;
+   // The amount of positions searched.
+   uint64_t                  nodes  = 0;
+   // The amount of moves in the solution. 0 unless solved.
+   size_t                    length = 0;
+   // The moves that win, including the automatic ones. Empty unless solved
+   // and asked for.
+   std::vector<Move>         moves;
+};
+
+/// @brief A freecell position written out so that positions which only
+///        differ by the order of the columns or of the free cells come out
+///        byte for byte the same. Cards are written as their id plus one.
+///        First the four foundation ranks, then the four cells sorted with
+///        0 for empty, then the columns sorted with a 0 after each one.
+///        That is at most 4 + 4 + 52 + 8 = 68 bytes. The rest is always 0 so
+///        the whole thing can be hashed and compared a word at a time.
+struct FreecellKey
+{
+   static constexpr size_t words = 9;
+
+   uint8_t bytes[words * 8] = {};
+
+   /// @brief Compare two keys.
+   /// @param other The other key.
+   /// @return True if they are the same position.
+   bool operator==(const FreecellKey& other) const
+   {
+      return std::memcmp(bytes, other.bytes, sizeof(bytes)) == 0;
+   }
+
+   /// @brief Hash the key.
+   /// @return The hash.
+   uint64_t Hash() const
+   {
+      uint64_t out = 0;
+      for (size_t i = 0; i < words; i++)
+      {
+         uint64_t word;
+         std::memcpy(&word, bytes + i * 8, 8);
+         out = Random::SplitMix64(out ^ word);
+      }
+      return out;
+   }
+};
+
+/// @brief A freecell position in one flat block so it is cheap to copy and
+///        to change in place.
+struct FreecellPosition
+{
+   // A column is dealt at most seven cards and can then take at most twelve
+   // more, down to a two on the top card dealt, so nineteen is the most.
+   static constexpr size_t column_capacity = 20;
+
+   // The columns. The last card of each is the top.
+   PackedStandardPlayingCard columns[8][column_capacity];
+   // The amount of cards in each column.
+   uint8_t                   lengths[8]     = {0, 0, 0, 0, 0, 0, 0, 0};
+   // The free cells, packed to the front.
+   PackedStandardPlayingCard cells[4];
+   // The amount of free cells in use.
+   uint8_t                   cell_count     = 0;
+   // The top rank on each foundation, by suit index. 0 is empty.
+   uint8_t                   foundations[4] = {0, 0, 0, 0};
+
+   /// @brief Copy a position from piles shaped like the game's.
+   /// @param board The board piles. Missing piles are empty.
+   /// @param free The free cells.
+   /// @param stacks The stacks by suit index.
+   template<typename Board, typename Free, typename Stacks>
+   void Load(const Board& board, const Free& free, const Stacks& stacks)
+   {
+      for (size_t i = 0; i < 8; i++)
+      {
+         lengths[i] = 0;
+         if (i < board.size())
+         {
+            for (const auto& card : board[i])
+            {
+               columns[i][lengths[i]++] = card;
+            }
+         }
+      }
+      cell_count = 0;
+      for (const auto& card : free)
+      {
+         cells[cell_count++] = card;
+      }
+      for (size_t i = 0; i < 4; i++)
+      {
+         foundations[i] = i < stacks.size() ? stacks[i].size() : 0;
+      }
+   }
+
+   /// @brief Deal 52 cards onto an empty board. Card "i" goes on column
+   ///        i % 8, like "Freecell::DealByNumber".
+   /// @param order The card ids in the order they are dealt.
+   void LoadDeal(const uint8_t* order)
+   {
+      for (size_t i = 0; i < 8; i++)
+      {
+         lengths[i] = 0;
+      }
+      for (size_t i = 0; i < 52; i++)
+      {
+         columns[i % 8][lengths[i % 8]++] =
+            PackedStandardPlayingCard::FromId(order[i]);
+      }
+      cell_count = 0;
+      for (size_t i = 0; i < 4; i++)
+      {
+         foundations[i] = 0;
+      }
+   }
+
+   /// @brief Get the top card of a column. The column must not be empty.
+   /// @param column The column.
+   /// @return The top card.
+   PackedStandardPlayingCard Top(const size_t column) const
+   {
+      return columns[column][lengths[column] - 1];
+   }
+
+   /// @brief Count the cards on top of a column that are in descending
+   ///        alternating colours.
+   /// @param column The column.
+   /// @return The length of the run. 0 if the column is empty.
+   size_t RunLength(const size_t column) const
+   {
+      size_t length = lengths[column];
+      if (length == 0)
+      {
+         return 0;
+      }
+      size_t run = 1;
+      while (run < length &&
+             CanPlaceOn(columns[column][length - run],
+                        columns[column][length - run - 1]))
+      {
+         run++;
+      }
+      return run;
+   }
+
+   /// @brief Check if a card can go on another card in a column.
+   /// @param card The card being moved.
+   /// @param onto The card it would go on.
+   /// @return True if the rank is one lower and the colour is different.
+   static bool CanPlaceOn(const PackedStandardPlayingCard card,
+                          const PackedStandardPlayingCard onto)
+   {
+      return onto.GetRank() == card.GetRank() + 1 &&
+             ((onto.GetSuitIndex() ^ card.GetSuitIndex()) & 1);
+   }
+
+   /// @brief Check if a card can go on its foundation.
+   /// @param card The card.
+   /// @return True if it is the next rank for its suit.
+   bool CanFound(const PackedStandardPlayingCard card) const
+   {
+      return foundations[card.GetSuitIndex()] + 1 == card.GetRank();
+   }
+
+   /// @brief The most cards that can be moved to a column at once. This is
+   ///        the same rule as "Freecell::CheckMoveAmount".
+   /// @param column The column the cards are going to.
+   /// @return The amount.
+   size_t MoveLimit(const size_t column) const
+   {
+      size_t empties = 0;
+      for (size_t i = 0; i < 8; i++)
+      {
+         empties += lengths[i] == 0;
+      }
+      size_t free_cells = 4 - cell_count;
+      if (empties == 0 || (empties == 1 && lengths[column] == 0))
+      {
+         return free_cells + 1;
+      }
+      return (empties + 1) * (free_cells + 1);
+   }
+
+   /// @brief Check if every card is on the foundations.
+   /// @return True if the game is won. False otherwise.
+   bool Won() const
+   {
+      return foundations[0] == 13 && foundations[1] == 13 &&
+             foundations[2] == 13 && foundations[3] == 13;
+   }
+
+   /// @brief Write the position out so column and cell order don't matter.
+   /// @return The key.
+   FreecellKey Canonical() const
+   {
+      FreecellKey out;
+      size_t at = 0;
+      for (size_t i = 0; i < 4; i++)
+      {
+         out.bytes[at++] = foundations[i];
+      }
+
+      // Sort the cells. There are only four so this is a tiny insertion
+      // sort.
+      uint8_t sorted_cells[4] = {0, 0, 0, 0};
+      for (size_t i = 0; i < cell_count; i++)
+      {
+         uint8_t card = cells[i].GetId() + 1;
+         size_t j = i;
+         for (; j > 0 && sorted_cells[j - 1] > card; j--)
+         {
+            sorted_cells[j] = sorted_cells[j - 1];
+         }
+         sorted_cells[j] = card;
+      }
+      for (size_t i = 0; i < 4; i++)
+      {
+         out.bytes[at++] = sorted_cells[i];
+      }
+
+      // Sort the columns by their cards from the bottom up.
+      size_t order[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+      for (size_t i = 1; i < 8; i++)
+      {
+         size_t column = order[i];
+         size_t j = i;
+         for (; j > 0 && ColumnLess(column, order[j - 1]); j--)
+         {
+            order[j] = order[j - 1];
+         }
+         order[j] = column;
+      }
+      for (size_t i = 0; i < 8; i++)
+      {
+         for (size_t j = 0; j < lengths[order[i]]; j++)
+         {
+            out.bytes[at++] = columns[order[i]][j].GetId() + 1;
+         }
+         out.bytes[at++] = 0;
+      }
+      return out;
+   }
+
+   /// @brief Order two columns by their cards from the bottom up. Shorter
+   ///        columns come first when one starts the other.
+   /// @param a The first column.
+   /// @param b The second column.
+   /// @return True if "a" goes before "b".
+   bool ColumnLess(const size_t a, const size_t b) const
+   {
+      size_t length = std::min(lengths[a], lengths[b]);
+      for (size_t i = 0; i < length; i++)
+      {
+         if (columns[a][i].GetId() != columns[b][i].GetId())
+         {
+            return columns[a][i].GetId() < columns[b][i].GetId();
+         }
+      }
+      return lengths[a] < lengths[b];
+   }
+
+   /// @brief Get the card a move picks up first. For a run this is the
+   ///        bottom card of the run.
+   /// @param move The move. It must be legal.
+   /// @return The card.
+   PackedStandardPlayingCard MovingCard(const Move& move) const
+   {
+      if (move.from == MovePlace::cell)
+      {
+         return cells[move.from_index];
+      }
+      if (move.from == MovePlace::foundation)
+      {
+         return PackedStandardPlayingCard(foundations[move.from_index],
+                                          size_t(move.from_index));
+      }
+      return columns[move.from_index][lengths[move.from_index] - move.amount];
+   }
+
+   /// @brief Check if a move can be made. Like the game, a card taken back
+   ///        off the foundations never goes onto an empty column.
+   /// @param move The move.
+   /// @return True if it is legal. False otherwise.
+   bool IsLegal(const Move& move) const
+   {
+      // Check the source.
+      if (move.from == MovePlace::column)
+      {
+         if (move.from_index >= 8 || move.amount < 1 ||
+             move.amount > lengths[move.from_index] ||
+             move.amount > RunLength(move.from_index))
+         {
+            return false;
+         }
+      }
+      else if (move.from == MovePlace::cell)
+      {
+         if (move.from_index >= cell_count || move.amount != 1)
+         {
+            return false;
+         }
+      }
+      else if (move.from == MovePlace::foundation)
+      {
+         if (move.from_index >= 4 || foundations[move.from_index] == 0 ||
+             move.amount != 1 || move.to == MovePlace::foundation ||
+             (move.to == MovePlace::column && move.to_index < 8 &&
+              lengths[move.to_index] == 0))
+         {
+            return false;
+         }
+      }
+      else
+      {
+         return false;
+      }
+
+      // Check the target.
+      PackedStandardPlayingCard card = MovingCard(move);
+      if (move.to == MovePlace::foundation)
+      {
+         return move.amount == 1 && move.to_index == card.GetSuitIndex() &&
+                CanFound(card);
+      }
+      else if (move.to == MovePlace::cell)
+      {
+         return move.from != MovePlace::cell && move.amount == 1 &&
+                cell_count < 4;
+      }
+      return move.to_index < 8 &&
+             !(move.from == MovePlace::column &&
+               move.from_index == move.to_index) &&
+             move.amount <= MoveLimit(move.to_index) &&
+             (lengths[move.to_index] == 0 ||
+              CanPlaceOn(card, Top(move.to_index)));
+   }
+
+   /// @brief Make a move. It must be legal.
+   /// @param move The move.
+   void Apply(const Move& move)
+   {
+      // Pick the cards up.
+      PackedStandardPlayingCard hand[13];
+      if (move.from == MovePlace::column)
+      {
+         lengths[move.from_index] -= move.amount;
+         for (size_t i = 0; i < move.amount; i++)
+         {
+            hand[i] = columns[move.from_index][lengths[move.from_index] + i];
+         }
+      }
+      else if (move.from == MovePlace::foundation)
+      {
+         hand[0] = PackedStandardPlayingCard(foundations[move.from_index]--,
+                                             size_t(move.from_index));
+      }
+      else
+      {
+         hand[0] = cells[move.from_index];
+         for (size_t i = move.from_index; i + 1 < cell_count; i++)
+         {
+            cells[i] = cells[i + 1];
+         }
+         cell_count--;
+      }
+
+      // Put them down.
+      if (move.to == MovePlace::column)
+      {
+         for (size_t i = 0; i < move.amount; i++)
+         {
+            columns[move.to_index][lengths[move.to_index]++] = hand[i];
+         }
+      }
+      else if (move.to == MovePlace::cell)
+      {
+         cells[cell_count++] = hand[0];
+      }
+      else
+      {
+         foundations[move.to_index]++;
+      }
+   }
+
+   /// @brief Take back a move that was just made.
+   /// @param move The move.
+   void Undo(const Move& move)
+   {
+      // Pick the cards back up from where they went.
+      PackedStandardPlayingCard hand[13];
+      if (move.to == MovePlace::column)
+      {
+         lengths[move.to_index] -= move.amount;
+         for (size_t i = 0; i < move.amount; i++)
+         {
+            hand[i] = columns[move.to_index][lengths[move.to_index] + i];
+         }
+      }
+      else if (move.to == MovePlace::cell)
+      {
+         hand[0] = cells[--cell_count];
+      }
+      else
+      {
+         hand[0] = PackedStandardPlayingCard(foundations[move.to_index]--,
+                                             size_t(move.to_index));
+      }
+
+      // Put them back where they came from.
+      if (move.from == MovePlace::column)
+      {
+         for (size_t i = 0; i < move.amount; i++)
+         {
+            columns[move.from_index][lengths[move.from_index]++] = hand[i];
+         }
+      }
+      else if (move.from == MovePlace::foundation)
+      {
+         foundations[move.from_index]++;
+      }
+      else
+      {
+         for (size_t i = cell_count; i > move.from_index; i--)
+         {
+            cells[i] = cells[i - 1];
+         }
+         cells[move.from_index] = hand[0];
+         cell_count++;
+      }
+   }
+
+   /// @brief Write the legal moves. The search only wants the moves worth
+   ///        making, so it can leave out taking cards back off the
+   ///        foundations and only use the first empty column.
+   /// @param out Where the moves go. Must have room for "max_legal_moves".
+   /// @param from_foundations Whether to include taking cards back off the
+   ///                         foundations.
+   /// @param every_empty Whether to move into every empty column and to
+   ///                    move whole columns into them. Otherwise only the
+   ///                    first empty column is used, since any other is the
+   ///                    same move, and a whole column is never moved.
+   /// @return The amount of moves written.
+   size_t GenerateMoves(Move*      out,
+                        const bool from_foundations = true,
+                        const bool every_empty = true) const
+   {
+      size_t count = 0;
+
+      // The empty columns. Without "every_empty" only the first is kept.
+      size_t empties[8];
+      size_t empty_count = 0;
+      for (size_t i = 0; i < 8; i++)
+      {
+         if (lengths[i] == 0 && (every_empty || empty_count == 0))
+         {
+            empties[empty_count++] = i;
+         }
+      }
+
+      // Anything that can go to the foundations.
+      for (size_t i = 0; i < cell_count; i++)
+      {
+         if (CanFound(cells[i]))
+         {
+            out[count++] = {MovePlace::cell, uint8_t(i),
+                            MovePlace::foundation,
+                            uint8_t(cells[i].GetSuitIndex()), 1};
+         }
+      }
+      for (size_t i = 0; i < 8; i++)
+      {
+         if (lengths[i] > 0 && CanFound(Top(i)))
+         {
+            out[count++] = {MovePlace::column, uint8_t(i),
+                            MovePlace::foundation,
+                            uint8_t(Top(i).GetSuitIndex()), 1};
+         }
+      }
+
+      // Runs onto other columns. Only one amount can ever fit.
+      for (size_t from = 0; from < 8; from++)
+      {
+         size_t run = RunLength(from);
+         for (size_t to = 0; to < 8 && run > 0; to++)
+         {
+            if (to == from || lengths[to] == 0)
+            {
+               continue;
+            }
+            PackedStandardPlayingCard onto = Top(to);
+            int amount = onto.GetRank() - 1 - Top(from).GetRank() + 1;
+            if (amount >= 1 && size_t(amount) <= run &&
+                size_t(amount) <= MoveLimit(to) &&
+                CanPlaceOn(columns[from][lengths[from] - amount], onto))
+            {
+               out[count++] = {MovePlace::column, uint8_t(from),
+                               MovePlace::column, uint8_t(to),
+                               uint8_t(amount)};
+            }
+         }
+      }
+
+      // Free cells onto columns.
+      for (size_t i = 0; i < cell_count; i++)
+      {
+         for (size_t to = 0; to < 8; to++)
+         {
+            if (lengths[to] > 0 && CanPlaceOn(cells[i], Top(to)))
+            {
+               out[count++] = {MovePlace::cell, uint8_t(i),
+                               MovePlace::column, uint8_t(to), 1};
+            }
+         }
+      }
+
+      // Into the empty columns.
+      for (size_t e = 0; e < empty_count; e++)
+      {
+         size_t empty = empties[e];
+         for (size_t i = 0; i < cell_count; i++)
+         {
+            out[count++] = {MovePlace::cell, uint8_t(i),
+                            MovePlace::column, uint8_t(empty), 1};
+         }
+         size_t limit = MoveLimit(empty);
+         for (size_t from = 0; from < 8; from++)
+         {
+            size_t run = std::min(RunLength(from), limit);
+            for (size_t amount = run; amount >= 1; amount--)
+            {
+               // Moving a whole column to an empty one does nothing, so
+               // the search leaves it out.
+               if (every_empty || amount < lengths[from])
+               {
+                  out[count++] = {MovePlace::column, uint8_t(from),
+                                  MovePlace::column, uint8_t(empty),
+                                  uint8_t(amount)};
+               }
+            }
+         }
+      }
+
+      // Cards back off the foundations. Like the game, never onto an empty
+      // column.
+      for (size_t suit = 0; suit < 4 && from_foundations; suit++)
+      {
+         if (foundations[suit] == 0)
+         {
+            continue;
+         }
+         PackedStandardPlayingCard card(foundations[suit], suit);
+         for (size_t to = 0; to < 8; to++)
+         {
+            if (lengths[to] > 0 && CanPlaceOn(card, Top(to)))
+            {
+               out[count++] = {MovePlace::foundation, uint8_t(suit),
+                               MovePlace::column, uint8_t(to), 1};
+            }
+         }
+         if (cell_count < 4)
+         {
+            out[count++] = {MovePlace::foundation, uint8_t(suit),
+                            MovePlace::cell, 0, 1};
+         }
+      }
+
+      // Last of all, columns into a free cell.
+      if (cell_count < 4)
+      {
+         for (size_t from = 0; from < 8; from++)
+         {
+            if (lengths[from] > 0)
+            {
+               out[count++] = {MovePlace::column, uint8_t(from),
+                               MovePlace::cell, 0, 1};
+            }
+         }
+      }
+      return count;
+   } // GenerateMoves
+};
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief Solves freecell deals with a depth first search.
+///
+///        Positions are hashed with Zobrist keys, one random key per card
+///        and place, so each move only changes the hash by a few XORs.
+///        Positions that only differ by the order of the columns or of the
+///        free cells are the same position, so they hash the same. Cells
+///        share one key per card, and each column is hashed on its own with
+///        keys for its depths and then mixed and summed with the others.
+///        That can cut the positions searched by up to 8! * 4!.
+///
+///        Seen positions go in a direct mapped table of hashes with a fixed
+///        size. When two positions want the same slot the newer one wins,
+///        which only costs time. Only the 64 bit hash is stored and not the
+///        position, so two positions with the same hash would count as one
+///        and a solution could be missed, but that is astronomically
+///        unlikely. Each solve salts the stored hashes so the table never
+///        has to be cleared between deals.
+///
+///        Cards that nothing can need any more are moved to the foundations
+///        automatically after every move. A card is safe when it is an ace
+///        or a two, or when both foundations of the other colour are at
+///        least one rank below it.
+///
+///        The moves from each position are tried best first, scored by how
+///        many cards are home, how many cells and columns are open and how
+///        deep the next cards for the foundations are buried. The search
+///        keeps its own stack so long paths can't overflow the real one.
+///
+///        Multi card moves use the same limit as the game so every solution
+///        can be played in "Freecell" exactly as given. Cards are never
+///        taken back off the foundations, so "unsolvable" means unsolvable
+///        without doing that.
+class FreecellSolver
+{
+   private:
+      // ----------------------------------------------------------------------
+      // Private Variables block.
+      // ----------------------------------------------------------------------
+
+      /// @brief The random keys for every card in every place. Columns share
+      ///        one set of keys so a column hashes the same wherever it is.
+      struct Keys
+      {
+         uint64_t column[FreecellPosition::column_capacity][52];
+         uint64_t cell[52];
+         uint64_t foundation[4][14];
+
+         Keys()
+         {
+            uint64_t counter = 0;
+            for (auto& position_keys : column)
+            {
+               for (auto& key : position_keys)
+               {
+                  key = Random::SplitMix64(counter++);
+               }
+            }
+            for (auto& key : cell)
+            {
+               key = Random::SplitMix64(counter++);
+            }
+            for (auto& suit_keys : foundation)
+            {
+               for (auto& key : suit_keys)
+               {
+                  key = Random::SplitMix64(counter++);
+               }
+            }
+         }
+      };
+
+      /// @brief Get the keys. They are made once and shared by all solvers.
+      /// @return The keys.
+      static const Keys& GetKeys()
+      {
+         static const Keys keys;
+         return keys;
+      }
+
+      /// @brief The parts of the hash a move can change, saved so the move
+      ///        can be taken back.
+      struct HashState
+      {
+         uint64_t rest;
+         uint64_t column_sum;
+         uint64_t from_column;
+         uint64_t to_column;
+      };
+
+      /// @brief Where the search is in one position.
+      struct Frame
+      {
+         // The moves for this position are buffer[first] to buffer[last].
+         size_t first;
+         size_t last;
+         // The next move to try.
+         size_t next;
+         // The length of "path" at this position.
+         size_t mark;
+      };
+
+      // The position being searched.
+      FreecellPosition          position;
+      // The hash of each column on its own.
+      uint64_t                  column_hashes[8];
+      // The sum of every mixed column hash. A sum doesn't care about order
+      // so swapping two columns leaves it the same.
+      uint64_t                  column_sum = 0;
+      // The cells and foundations hashed together.
+      uint64_t                  rest = 0;
+      // The seen table. Each slot holds a salted hash or 0.
+      std::vector<uint64_t>     table;
+      // The salt for the current solve.
+      uint64_t                  salt = 0;
+      // The amount of solves so far. Used to make the salt.
+      uint64_t                  solves = 0;
+      // The moves from the start to "position".
+      std::vector<Move>         path;
+      // The hash before each move in "path".
+      std::vector<HashState>    history;
+      // The moves to try at every depth, one depth after another.
+      std::vector<Move>         buffer;
+      // The amount of "buffer" in use. The rest is room to write into.
+      size_t                    buffer_used = 0;
+      // Scratch space for putting moves in order.
+      std::vector<std::pair<int, Move>> ranked;
+      // The positions on the current path that still have moves to try.
+      std::vector<Frame>        frames;
+      // The amount of positions searched and the most allowed.
+      uint64_t                  nodes     = 0;
+      uint64_t                  max_nodes = 0;
+      // Whether the search was cut short by "max_nodes".
+      bool                      ran_out   = false;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Private Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Hash the whole position from scratch.
+      void HashPosition()
+      {
+         const Keys& keys = GetKeys();
+         column_sum = 0;
+         for (size_t i = 0; i < 8; i++)
+         {
+            column_hashes[i] = 0;
+            for (size_t j = 0; j < position.lengths[i]; j++)
+            {
+               column_hashes[i] ^=
+                  keys.column[j][position.columns[i][j].GetId()];
+            }
+            column_sum += Random::SplitMix64(column_hashes[i]);
+         }
+         rest = 0;
+         for (size_t i = 0; i < position.cell_count; i++)
+         {
+            rest ^= keys.cell[position.cells[i].GetId()];
+         }
+         for (size_t i = 0; i < 4; i++)
+         {
+            rest ^= keys.foundation[i][position.foundations[i]];
+         }
+      }
+
+      /// @brief Get the hash of the current position. Positions that only
+      ///        differ by the order of the columns or cells hash the same.
+      /// @return The hash.
+      uint64_t Hash() const { return rest ^ column_sum; }
+
+      /// @brief Make a move, update the hash and remember it.
+      /// @param move The move.
+      void Push(const Move& move)
+      {
+         const Keys& keys = GetKeys();
+         const bool from_column = move.from == MovePlace::column;
+         const bool to_column   = move.to == MovePlace::column;
+         HashState saved = {rest, column_sum,
+                            from_column ? column_hashes[move.from_index] : 0,
+                            to_column ? column_hashes[move.to_index] : 0};
+
+         for (size_t i = 0; i < move.amount; i++)
+         {
+            PackedStandardPlayingCard card;
+            if (from_column)
+            {
+               size_t from = position.lengths[move.from_index] -
+                             move.amount + i;
+               card = position.columns[move.from_index][from];
+               column_hashes[move.from_index] ^=
+                  keys.column[from][card.GetId()];
+            }
+            else
+            {
+               card = position.cells[move.from_index];
+               rest ^= keys.cell[card.GetId()];
+            }
+
+            if (to_column)
+            {
+               size_t to = position.lengths[move.to_index] + i;
+               column_hashes[move.to_index] ^= keys.column[to][card.GetId()];
+            }
+            else if (move.to == MovePlace::cell)
+            {
+               rest ^= keys.cell[card.GetId()];
+            }
+            else
+            {
+               size_t rank = position.foundations[move.to_index];
+               rest ^= keys.foundation[move.to_index][rank] ^
+                       keys.foundation[move.to_index][rank + 1];
+            }
+         }
+         if (from_column)
+         {
+            column_sum += Random::SplitMix64(column_hashes[move.from_index]) -
+                          Random::SplitMix64(saved.from_column);
+         }
+         if (to_column)
+         {
+            column_sum += Random::SplitMix64(column_hashes[move.to_index]) -
+                          Random::SplitMix64(saved.to_column);
+         }
+
+         position.Apply(move);
+         path.push_back(move);
+         history.push_back(saved);
+      }
+
+      /// @brief Take back the last move.
+      void Pop()
+      {
+         const Move& move  = path.back();
+         const HashState&    saved = history.back();
+         position.Undo(move);
+         rest = saved.rest;
+         column_sum = saved.column_sum;
+         if (move.from == MovePlace::column)
+         {
+            column_hashes[move.from_index] = saved.from_column;
+         }
+         if (move.to == MovePlace::column)
+         {
+            column_hashes[move.to_index] = saved.to_column;
+         }
+         path.pop_back();
+         history.pop_back();
+      }
+
+      /// @brief Check if a card can never be needed on the board again.
+      /// @param card The card.
+      /// @return True if it is safe to put on its foundation.
+      bool SafeToFound(const PackedStandardPlayingCard card) const
+      {
+         if (!position.CanFound(card))
+         {
+            return false;
+         }
+         int    rank  = card.GetRank();
+         size_t other = (card.GetSuitIndex() & 1) ^ 1;
+         return rank <= 2 ||
+                (position.foundations[other] + 1 >= rank &&
+                 position.foundations[other + 2] + 1 >= rank);
+      }
+
+      /// @brief Move every safe card to the foundations.
+      void AutoPlay()
+      {
+         bool moved = true;
+         while (moved)
+         {
+            moved = false;
+            for (size_t i = 0; i < position.cell_count; i++)
+            {
+               if (SafeToFound(position.cells[i]))
+               {
+                  Push({MovePlace::cell, uint8_t(i),
+                        MovePlace::foundation,
+                        uint8_t(position.cells[i].GetSuitIndex()), 1});
+                  moved = true;
+                  i--;
+               }
+            }
+            for (size_t i = 0; i < 8; i++)
+            {
+               while (position.lengths[i] > 0 &&
+                      SafeToFound(position.Top(i)))
+               {
+                  Push({MovePlace::column, uint8_t(i),
+                        MovePlace::foundation,
+                        uint8_t(position.Top(i).GetSuitIndex()), 1});
+                  moved = true;
+               }
+            }
+         }
+      }
+
+      /// @brief Add the current position to the seen table.
+      /// @return True if it was new. False if it was already there.
+      bool MarkSeen()
+      {
+         const uint64_t hash = Hash();
+         uint64_t stored = (hash ^ salt) | 1;
+         uint64_t& slot = table[hash & (table.size() - 1)];
+         if (slot == stored)
+         {
+            return false;
+         }
+         slot = stored;
+         return true;
+      }
+
+      /// @brief Score the current position. Higher is closer to a win.
+      /// @return The score.
+      int Evaluate() const
+      {
+         // Every card home is worth a lot.
+         int out = 0;
+         for (size_t i = 0; i < 4; i++)
+         {
+            out += 16 * position.foundations[i];
+         }
+
+         // Open cells and columns are what let cards move.
+         out -= 4 * position.cell_count;
+         for (size_t i = 0; i < 8; i++)
+         {
+            if (position.lengths[i] == 0)
+            {
+               out += 8;
+               continue;
+            }
+            // Cards buried over the next card each foundation needs.
+            for (size_t j = 0; j < position.lengths[i]; j++)
+            {
+               if (position.CanFound(position.columns[i][j]))
+               {
+                  out -= 3 * int(position.lengths[i] - j - 1);
+               }
+            }
+         }
+         return out;
+      }
+
+      /// @brief Put the moves for a position in order, best first. Each move
+      ///        is tried and the position it leads to is scored.
+      /// @param first The first move in "buffer".
+      /// @param last One past the last move in "buffer".
+      void OrderMoves(const size_t first, const size_t last)
+      {
+         ranked.clear();
+         for (size_t i = first; i < last; i++)
+         {
+            size_t mark = path.size();
+            Push(buffer[i]);
+            AutoPlay();
+            ranked.push_back({Evaluate(), buffer[i]});
+            while (path.size() > mark)
+            {
+               Pop();
+            }
+         }
+         // Stable so ties keep the order they were made in.
+         std::stable_sort(ranked.begin(), ranked.end(),
+                          [](const std::pair<int, Move>& a,
+                             const std::pair<int, Move>& b)
+                          {
+                             return a.first > b.first;
+                          });
+         for (size_t i = first; i < last; i++)
+         {
+            buffer[i] = ranked[i - first].second;
+         }
+      }
+
+      /// @brief Start searching the current position. If it is new its
+      ///        moves are added to "buffer" and a frame is pushed for it.
+      void Enter()
+      {
+         if (nodes >= max_nodes)
+         {
+            ran_out = true;
+            return;
+         }
+         if (!MarkSeen())
+         {
+            return;
+         }
+         nodes++;
+
+         Frame frame;
+         frame.first = buffer_used;
+         if (buffer.size() < frame.first + max_legal_moves)
+         {
+            buffer.resize(2 * buffer.size() + max_legal_moves);
+         }
+         frame.last = frame.first +
+                      position.GenerateMoves(buffer.data() + frame.first,
+                                             false, false);
+         buffer_used = frame.last;
+         OrderMoves(frame.first, frame.last);
+         frame.next = frame.first;
+         frame.mark = path.size();
+         frames.push_back(frame);
+      }
+
+      /// @brief Search from the current position. This keeps its own stack
+      ///        of frames instead of recursing since a path can be many
+      ///        thousands of moves long.
+      /// @return True if it leads to a win. The winning moves are left in
+      ///         "path".
+      bool Search()
+      {
+         frames.clear();
+         if (position.Won())
+         {
+            return true;
+         }
+         Enter();
+
+         while (!frames.empty() && !ran_out)
+         {
+            Frame& frame = frames.back();
+            // Take back whatever the last move tried from here did.
+            while (path.size() > frame.mark)
+            {
+               Pop();
+            }
+            if (frame.next == frame.last)
+            {
+               buffer_used = frame.first;
+               frames.pop_back();
+               continue;
+            }
+
+            Push(buffer[frame.next++]);
+            AutoPlay();
+            if (position.Won())
+            {
+               return true;
+            }
+            Enter();
+         }
+         return false;
+      } // Search
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Make a solver. The solver can be reused for many deals.
+      /// @param table_bits The seen table has 2^table_bits slots of 8 bytes.
+      explicit FreecellSolver(const size_t table_bits = 20):
+         table(size_t(1) << table_bits, 0)
+      {
+         path.reserve(512);
+         history.reserve(512);
+         buffer.resize(4096);
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Solve a position.
+      /// @param start The position to start from.
+      /// @param max_nodes_input Give up after this many positions.
+      /// @param keep_moves Whether to copy the solution out. Leave it off
+      ///                   when only the result matters and nothing will be
+      ///                   allocated.
+      /// @return What was found.
+      FreecellSolveResult Solve(const FreecellPosition& start,
+                                const uint64_t max_nodes_input = 1000000,
+                                const bool     keep_moves = true)
+      {
+         position = start;
+         HashPosition();
+         salt = Random::SplitMix64(++solves);
+         path.clear();
+         history.clear();
+         buffer_used = 0;
+         nodes = 0;
+         max_nodes = max_nodes_input;
+         ran_out = false;
+
+         FreecellSolveResult result;
+         AutoPlay();
+         if (Search())
+         {
+            result.status = FreecellSolveStatus::solved;
+            result.length = path.size();
+            if (keep_moves)
+            {
+               result.moves = path;
+            }
+         }
+         else if (!ran_out)
+         {
+            result.status = FreecellSolveStatus::unsolvable;
+         }
+         result.nodes = nodes;
+         return result;
+      }
+
+      /// @brief Solve a game where it stands.
+      /// @param game The game.
+      /// @param max_nodes_input Give up after this many positions.
+      /// @return What was found.
+      FreecellSolveResult Solve(const Freecell&  game,
+                                const uint64_t   max_nodes_input = 1000000)
+      {
+         FreecellPosition start;
+         start.Load(game.GetBoard(), game.GetFree(), game.GetStacks());
+         return Solve(start, max_nodes_input);
+      }
+
+      /// @brief Check that a list of moves is legal and wins.
+      /// @param start The position to start from.
+      /// @param moves The moves.
+      /// @return True if every move is legal and the game ends won.
+      static bool Verify(const FreecellPosition&  start,
+                         const std::vector<Move>& moves)
+      {
+         FreecellPosition check = start;
+         for (const auto& move : moves)
+         {
+            if (!check.IsLegal(move))
+            {
+               return false;
+            }
+            check.Apply(move);
+         }
+         return check.Won();
+      }
+      // ----------------------------------------------------------------------
+}; // FreecellSolver
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Write the legal moves for a freecell position without allocating.
+///        Every legal move is written, including cards back off the
+///        foundations.
+/// @param state The position.
+/// @param out Where the moves go. Must have room for "max_legal_moves".
+/// @return The amount of moves written.
+inline size_t GenerateLegalMoves(const FreecellPosition& state, Move* out)
+{
+   return state.GenerateMoves(out);
+}
+
+/// @brief Write the legal moves for a freecell game without allocating.
+/// @param state The game.
+/// @param out Where the moves go. Must have room for "max_legal_moves".
+/// @return The amount of moves written.
+inline size_t GenerateLegalMoves(const Freecell& state, Move* out)
+{
+   FreecellPosition position;
+   position.Load(state.GetBoard(), state.GetFree(), state.GetStacks());
+   return position.GenerateMoves(out);
+}
+// ----------------------------------------------------------------------------
+} // Solitaire
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,445 @@
+#ifndef INLINEPILE_HPP
+#define INLINEPILE_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief The slots and the count of an "InlinePile". Slots past the count
+///        can still hold values that were taken off, but they are never
+///        read. When "T" can be copied byte for byte, so can the pile, and
+///        a whole game made of them can be cloned with one "memcpy".
+/// @tparam T The type held.
+/// @tparam N The amount of slots.
+template<typename T, size_t N, bool = std::is_trivially_copyable<T>::value>
+class InlinePileStorage
+{
+   protected:
+      // ----------------------------------------------------------------------
+      // Protected Variables block.
+      // ----------------------------------------------------------------------
+
+      // The smallest type that can count to "N".
+      using Count = std::conditional_t<(N <= UINT8_MAX), uint8_t, size_t>;
+
+      // The slots.
+      T     items[N] = {};
+      // The amount of slots in use.
+      Count count    = 0;
+      // ----------------------------------------------------------------------
+}; // InlinePileStorage
+
+/// @brief The slots and the count of an "InlinePile" of things that own
+///        something, like "std::unique_ptr". Moving a pile moves only the
+///        slots in use and leaves the old pile empty, like "std::vector".
+///        Slots past the count always hold a value-initialized "T", so
+///        nothing taken off the pile is kept alive.
+/// @tparam T The type held.
+/// @tparam N The amount of slots.
+template<typename T, size_t N>
+class InlinePileStorage<T, N, false>
+{
+   protected:
+      // ----------------------------------------------------------------------
+      // Protected Variables block.
+      // ----------------------------------------------------------------------
+
+      // The smallest type that can count to "N".
+      using Count = std::conditional_t<(N <= UINT8_MAX), uint8_t, size_t>;
+
+      // The slots.
+      T     items[N] = {};
+      // The amount of slots in use.
+      Count count    = 0;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Protected Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Put slots back to a fresh "T", letting go of what they own.
+      /// @param first The first slot.
+      /// @param last One past the last slot.
+      static void Reset(T* first, T* last)
+      {
+         for (; first != last; ++first)
+         {
+            *first = T();
+         }
+      }
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      InlinePileStorage() = default;
+
+      /// @brief Copy the slots in use.
+      /// @param other The pile to copy.
+      InlinePileStorage(const InlinePileStorage& other): count(other.count)
+      {
+         std::copy(other.items, other.items + count, items);
+      }
+
+      /// @brief Move the slots in use and leave the other pile empty.
+      /// @param other The pile to move.
+      InlinePileStorage(InlinePileStorage&& other) noexcept:
+         count(other.count)
+      {
+         std::move(other.items, other.items + count, items);
+         Reset(other.items, other.items + count);
+         other.count = 0;
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Operator Overloads block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Copy the slots in use.
+      /// @param other The pile to copy.
+      /// @return This pile.
+      InlinePileStorage& operator=(const InlinePileStorage& other)
+      {
+         if (this != &other)
+         {
+            std::copy(other.items, other.items + other.count, items);
+            if (count > other.count)
+            {
+               Reset(items + other.count, items + count);
+            }
+            count = other.count;
+         }
+         return *this;
+      }
+
+      /// @brief Move the slots in use and leave the other pile empty.
+      /// @param other The pile to move.
+      /// @return This pile.
+      InlinePileStorage& operator=(InlinePileStorage&& other) noexcept
+      {
+         if (this != &other)
+         {
+            std::move(other.items, other.items + other.count, items);
+            if (count > other.count)
+            {
+               Reset(items + other.count, items + count);
+            }
+            count = other.count;
+            Reset(other.items, other.items + other.count);
+            other.count = 0;
+         }
+         return *this;
+      }
+      // ----------------------------------------------------------------------
+}; // InlinePileStorage
+
+/// @brief A pile that keeps up to "N" things inside itself, with the parts
+///        of the "std::vector" interface the games use. Nothing is ever
+///        allocated, so a pile of packed cards is one small block that can
+///        sit inside a game, and a game's piles are next to each other in
+///        memory. Adding to a full pile is not allowed, the same as
+///        "CircularHand".
+/// @tparam T The type held.
+/// @tparam N The most it can hold.
+template<typename T, size_t N>
+class InlinePile: public InlinePileStorage<T, N>
+{
+   private:
+      // ----------------------------------------------------------------------
+      // Private Variables block.
+      // ----------------------------------------------------------------------
+
+      using Storage = InlinePileStorage<T, N>;
+      using Storage::items;
+      using Storage::count;
+      using Count = typename Storage::Count;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Private Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Put slots back to a fresh "T".
+      /// @param first The first slot.
+      /// @param last One past the last slot.
+      static void Reset(T* first, T* last)
+      {
+         for (; first != last; ++first)
+         {
+            *first = T();
+         }
+      }
+
+      /// @brief Put slots that are no longer used back to a fresh "T". This
+      ///        lets go of anything they owned. Plain values are left alone.
+      /// @param first The first slot.
+      /// @param last One past the last slot.
+      static void Release(T* first, T* last)
+      {
+         if constexpr (!std::is_trivially_copyable<T>::value)
+         {
+            Reset(first, last);
+         }
+      }
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Type Declarations block.
+      // ----------------------------------------------------------------------
+
+      using value_type             = T;
+      using size_type              = size_t;
+      using difference_type        = std::ptrdiff_t;
+      using reference              = T&;
+      using const_reference        = const T&;
+      using pointer                = T*;
+      using const_pointer          = const T*;
+      using iterator               = T*;
+      using const_iterator         = const T*;
+      using reverse_iterator       = std::reverse_iterator<iterator>;
+      using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      InlinePile() = default;
+
+      /// @brief Make a pile of fresh values.
+      /// @param size The amount. It must be at most "N".
+      explicit InlinePile(const size_t size) { resize(size); }
+
+      /// @brief Make a pile from a range.
+      /// @param first The start of the range.
+      /// @param last The end of the range. There must be at most "N".
+      template<typename Iterator, typename = typename
+               std::iterator_traits<Iterator>::iterator_category>
+      InlinePile(Iterator first, Iterator last) { assign(first, last); }
+
+      /// @brief Make a pile from a list.
+      /// @param list The list. It must have at most "N".
+      InlinePile(std::initializer_list<T> list)
+      {
+         assign(list.begin(), list.end());
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Get block.
+      // ----------------------------------------------------------------------
+
+      iterator begin() { return items; }
+      const_iterator begin() const { return items; }
+      const_iterator cbegin() const { return items; }
+      iterator end() { return items + count; }
+      const_iterator end() const { return items + count; }
+      const_iterator cend() const { return items + count; }
+      reverse_iterator rbegin() { return reverse_iterator(end()); }
+      const_reverse_iterator rbegin() const
+      {
+         return const_reverse_iterator(end());
+      }
+      reverse_iterator rend() { return reverse_iterator(begin()); }
+      const_reverse_iterator rend() const
+      {
+         return const_reverse_iterator(begin());
+      }
+
+      size_t size() const { return count; }
+      bool empty() const { return count == 0; }
+      static constexpr size_t capacity() { return N; }
+      static constexpr size_t max_size() { return N; }
+
+      T* data() { return items; }
+      const T* data() const { return items; }
+      T& operator[](const size_t i) { return items[i]; }
+      const T& operator[](const size_t i) const { return items[i]; }
+      T& front() { return items[0]; }
+      const T& front() const { return items[0]; }
+      T& back() { return items[count - 1]; }
+      const T& back() const { return items[count - 1]; }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Add to the end. The pile must not be full.
+      /// @param value The value.
+      void push_back(const T& value) { items[count++] = value; }
+      void push_back(T&& value) { items[count++] = std::move(value); }
+
+      /// @brief Make a value on the end. The pile must not be full.
+      /// @param args What to make it from.
+      /// @return The new value.
+      template<typename... Args>
+      T& emplace_back(Args&&... args)
+      {
+         items[count] = T(std::forward<Args>(args)...);
+         return items[count++];
+      }
+
+      /// @brief Take the last one off. The pile must not be empty.
+      void pop_back()
+      {
+         count--;
+         Release(items + count, items + count + 1);
+      }
+
+      /// @brief Take everything off.
+      void clear()
+      {
+         Release(items, items + count);
+         count = 0;
+      }
+
+      /// @brief Change the size. New slots get fresh values.
+      /// @param size The new size. It must be at most "N".
+      void resize(const size_t size)
+      {
+         if (size < count)
+         {
+            Release(items + size, items + count);
+         }
+         else
+         {
+            Reset(items + count, items + size);
+         }
+         count = static_cast<Count>(size);
+      }
+
+      /// @brief Change the size. New slots get a copy of a value.
+      /// @param size The new size. It must be at most "N".
+      /// @param value The value.
+      void resize(const size_t size, const T& value)
+      {
+         if (size < count)
+         {
+            Release(items + size, items + count);
+         }
+         else
+         {
+            std::fill(items + count, items + size, value);
+         }
+         count = static_cast<Count>(size);
+      }
+
+      /// @brief There is always room for "N", so this does nothing. It is
+      ///        here so code written for "std::vector" still works.
+      void reserve(const size_t) {}
+      void shrink_to_fit() {}
+
+      /// @brief Replace everything with a range.
+      /// @param first The start of the range.
+      /// @param last The end of the range. There must be at most "N".
+      template<typename Iterator>
+      void assign(Iterator first, Iterator last)
+      {
+         clear();
+         for (; first != last; ++first)
+         {
+            items[count++] = *first;
+         }
+      }
+
+      /// @brief Put a value in before a place. The pile must not be full.
+      /// @param place Where it goes.
+      /// @param value The value.
+      /// @return Where it went.
+      iterator insert(const_iterator place, T value)
+      {
+         T* at = items + (place - items);
+         std::move_backward(at, end(), end() + 1);
+         *at = std::move(value);
+         count++;
+         return at;
+      }
+
+      /// @brief Put a range in before a place. The pile must have room.
+      /// @param place Where it goes.
+      /// @param first The start of the range.
+      /// @param last The end of the range.
+      /// @return Where the first one went.
+      template<typename Iterator, typename = typename
+               std::iterator_traits<Iterator>::iterator_category>
+      iterator insert(const_iterator place, Iterator first, Iterator last)
+      {
+         T* at = items + (place - items);
+         const size_t amount = std::distance(first, last);
+         std::move_backward(at, end(), end() + amount);
+         std::copy(first, last, at);
+         count = static_cast<Count>(count + amount);
+         return at;
+      }
+
+      /// @brief Take one out.
+      /// @param place Which one.
+      /// @return The one after it.
+      iterator erase(const_iterator place)
+      {
+         return erase(place, place + 1);
+      }
+
+      /// @brief Take a run out.
+      /// @param first The first one.
+      /// @param last One past the last one.
+      /// @return The one after the run.
+      iterator erase(const_iterator first, const_iterator last)
+      {
+         T* from = items + (first - items);
+         T* to   = items + (last - items);
+         T* kept = std::move(to, end(), from);
+         Release(kept, end());
+         count = static_cast<Count>(kept - items);
+         return from;
+      }
+
+      /// @brief Swap with another pile. Only the slots in use are touched.
+      /// @param other The other pile.
+      void swap(InlinePile& other)
+      {
+         const size_t used = std::max<size_t>(count, other.count);
+         std::swap_ranges(items, items + used, other.items);
+         std::swap(count, other.count);
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Operator Overloads block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Whether two piles hold the same in the same order.
+      /// @param other The other pile.
+      /// @return True if they match.
+      bool operator==(const InlinePile& other) const
+      {
+         return std::equal(begin(), end(), other.begin(), other.end());
+      }
+      bool operator!=(const InlinePile& other) const
+      {
+         return !(*this == other);
+      }
+      // ----------------------------------------------------------------------
+}; // InlinePile
+// ----------------------------------------------------------------------------
+
+#endif
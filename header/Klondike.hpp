@@ -9,6 +9,8 @@
 // This is my own home grown utilities for this specific project.
 #include "Ansi.h"
 #include "Util.h"
+// Numbered deals.
+#include "MicrosoftDeals.h"
 
 // Regular File includes.
 // This is the header file for the "Solitaire" namespace and class.
@@ -27,7 +29,7 @@ namespace Solitaire
 // ----------------------------------------------------------------------------
 
 /// @brief This is the class implementation for a Klondike solitaire game.
-class Klondike: public Solitaire<PolarStandardPlayingCard>
+class Klondike: public Solitaire<PackedPolarStandardPlayingCard>
 {
    private:
       // ----------------------------------------------------------------------
@@ -79,19 +81,34 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
       {
          // First randomize the deck as it starts as an "out of the box" deck.
          deck.RandomizeDeck();
+         // Then deal it out.
+         DealDeck();
+      } // Deal
+
+      /// @brief Deal the deck as it is onto a fresh board. What is left over
+      ///        stays in the deck to draw from.
+      void DealDeck()
+      {
+         ALLOCATION_SCOPE(deal);
+
+         // Start from nothing so we can deal more than once.
+         board.clear();
+         stacks.clear();
+         free.clear();
+         history.clear();
 
          // Initialize the stacks.
          for (size_t i = 0; i < 4; i++)
          {
-            Pile<PolarStandardPlayingCard> temp = 
-               Pile<PolarStandardPlayingCard>();
+            Pile<PackedPolarStandardPlayingCard> temp = 
+               Pile<PackedPolarStandardPlayingCard>();
             stacks.push_back(std::move(temp));
          }
          
          // Now we will deal the cards.
          for (size_t i = 0; i < 7; i++)
          {
-            Pile<PolarStandardPlayingCard> temp;
+            Pile<PackedPolarStandardPlayingCard> temp;
 
             for (size_t j = 0; j < i + 1; j++)
             {
@@ -109,7 +126,7 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
 
             board.push_back(std::move(temp));
          }
-      } // Deal
+      } // DealDeck
 
       /// @brief This function will automatically move cards from the free
       ///        slots to the stacks.
@@ -123,7 +140,7 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
          // and if cards were moved return true.
          if (!free.empty())
          {
-            MoveFreeToStack(free.back()->GetSuit(), true);
+            MoveFreeToStack(free.back()->GetSuitType(), true);
             return free.size() != size;
          }
          // Otherwise as stated we return false.
@@ -159,37 +176,18 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
                 board[pile_from - 1][board[pile_from - 1].size() 
                   - amount]->GetRank() + 1) &&
                ((board[pile_from - 1][board[pile_from - 1].size() - amount]
-               ->GetColor() != board[pile_to - 1].back()->GetColor()))) ||
+               ->GetColorType() != 
+                  board[pile_to - 1].back()->GetColorType()))) ||
              ((board[pile_to - 1].empty()) &&
                (board[pile_from - 1][board[pile_from - 1].size() - amount]
                      ->GetFaceUp()) &&
                   (board[pile_from - 1][board[pile_from - 1].size() 
                      - amount]->GetRank() == 13))))
          {
-            // Define the temp variable.
-            Pile<PolarStandardPlayingCard> temp;
-            // Reserve the amount.
-            temp.reserve(amount);
-
-            // Move the cards to 'temp' and pop the blank memory slot.
-            for (size_t i = amount; 0 < i; i--)
-            {
-               temp.push_back(std::move(board[pile_from - 1].back()));
-               board[pile_from - 1].pop_back();
-            }
-            // Then push it to the new pile and pop the blank memory slots.
-            for (size_t i = amount; 0 < i; i--)
-            {
-               board[pile_to - 1].push_back(std::move(temp.back()));
-               temp.pop_back();
-            }
-
-            // If there is a flipped card then flip it.
-            if (!board[pile_from - 1].empty() &&
-               !board[pile_from - 1].back()->GetFaceUp())
-            {
-               board[pile_from - 1].back()->FlipCard();
-            }
+            // Move the cards. A face down card left on top gets flipped.
+            MakeMove({MovePlace::column, uint8_t(pile_from - 1),
+                      MovePlace::column, uint8_t(pile_to - 1),
+                      uint8_t(amount)});
          }
          else
          {
@@ -216,20 +214,21 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
              (1 <= pile_to && pile_to <= 7) &&
              (board[pile_to - 1].back()->GetRank() == 
                 free.back()->GetRank() + 1) &&
-             (free.back()->GetColor() != board[pile_to - 1].back()->GetColor()) &&
+             (free.back()->GetColorType() != 
+                board[pile_to - 1].back()->GetColorType()) &&
              (board[pile_to - 1].back()->GetFaceUp()) &&
              (free.back()->GetFaceUp()))
          {
-            // Move the card and then pop the memory slot.
-            board[pile_to - 1].push_back(std::move(free.back()));
-            free.pop_back();
+            // Move the card.
+            MakeMove({MovePlace::waste, 0,
+                      MovePlace::column, uint8_t(pile_to - 1), 1});
          }
          else if (board[pile_to - 1].empty() &&
                   free.back()->GetRank() == 13)
          {
             // Here we do something else for the kings.
-            board[pile_to - 1].push_back(std::move(free.back()));
-            free.pop_back();
+            MakeMove({MovePlace::waste, 0,
+                      MovePlace::column, uint8_t(pile_to - 1), 1});
          }
          else
          {
@@ -241,8 +240,8 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
       /// @brief This function moves the free cards to the stack.
       /// @param stack The stack suit we would like to move the card to.
       /// @param aut If this was called from the automatic function.
-      void MoveFreeToStack(const std::string stack,
-                           bool              aut)
+      void MoveFreeToStack(const Suit stack,
+                           bool       aut)
       {
          // This just gives the index of the stack vector.
          size_t stack_suit = GetStackSuit(stack);
@@ -251,12 +250,12 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
          // Make sure the suit matches the stack suit.
          // Check if we can even move that card to the stack.
          if ((free.back()->GetFaceUp()) &&
-             (free.back()->GetSuit() == stack) &&
+             (free.back()->GetSuitType() == stack) &&
              (CheckCardToStack(stack_suit)))
          {
-            // If we passed move the card and pop the memory slot.
-            stacks[stack_suit].push_back(std::move(free.back()));
-            free.pop_back();
+            // If we passed move the card.
+            MakeMove({MovePlace::waste, 0,
+                      MovePlace::foundation, uint8_t(stack_suit), 1});
          }
          else if (!aut)
          {
@@ -271,9 +270,9 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
       /// @param pile_from The index of the pile we are moving cards from.
       /// @param stack The stack suit we will be moving to.
       /// @param aut If this function was called by the auto function.
-      void MoveBoardToStack(const size_t      pile_from, 
-                            const std::string stack,
-                            bool              aut)
+      void MoveBoardToStack(const size_t pile_from, 
+                            const Suit   stack,
+                            bool         aut)
       {
          // This just gives the index of the stack vector.
          size_t stack_suit = GetStackSuit(stack);
@@ -281,23 +280,17 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
          // First check if the suits match.
          // Then check the ranks. If the stack is empty check we are adding
          // an ace otherwise check we are adding a card of one rank higher.
-         if ((board[pile_from - 1].back()->GetSuit() == stack) &&
+         if ((board[pile_from - 1].back()->GetSuitType() == stack) &&
              ((stacks[stack_suit].empty() && 
                board[pile_from - 1].back()->GetRank() == 1) ||
               (!stacks[stack_suit].empty() &&
                stacks[stack_suit].back()->GetRank() == 
                   board[pile_from - 1].back()->GetRank() - 1)))
          {
-            // If we passed move the card and pop the memory slot.
-            stacks[stack_suit].push_back(std::move(board[pile_from - 1].back()));
-            board[pile_from - 1].pop_back();
-
-            // Then flip the next card if it is face down.
-            if (!board[pile_from - 1].empty() && 
-               !board[pile_from - 1].back()->GetFaceUp())
-            {
-               board[pile_from - 1].back()->FlipCard();
-            }
+            // If we passed move the card. The next card gets flipped if it
+            // is face down.
+            MakeMove({MovePlace::column, uint8_t(pile_from - 1),
+                      MovePlace::foundation, uint8_t(stack_suit), 1});
          }
          else if (!aut)
          {
@@ -312,8 +305,8 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
       /// @param pile_to This is the board slot index we would like to
       ///                move the card to.
       /// @param stack This is the stack we are moving the card from.
-      void MoveStackToBoard(const size_t      pile_to, 
-                            const std::string stack)
+      void MoveStackToBoard(const size_t pile_to, 
+                            const Suit   stack)
       {
          // This just gives the index of the stack vector.
          size_t stack_suit = GetStackSuit(stack);
@@ -323,12 +316,12 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
          if ((!stacks[stack_suit].empty() && !board[pile_to - 1].empty()) &&
             (board[pile_to - 1].back()->GetRank() == 
                stacks[stack_suit].back()->GetRank() + 1) &&
-            (board[pile_to - 1].back()->GetColor() != 
-               stacks[stack_suit].back()->GetColor()))
+            (board[pile_to - 1].back()->GetColorType() != 
+               stacks[stack_suit].back()->GetColorType()))
          {
-            // If we passed move the card and pop the memory slot.
-            board[pile_to - 1].push_back(std::move(stacks[stack_suit].back()));
-            stacks[stack_suit].pop_back();
+            // If we passed move the card.
+            MakeMove({MovePlace::foundation, uint8_t(stack_suit),
+                      MovePlace::column, uint8_t(pile_to - 1), 1});
          }
          else
          {
@@ -340,8 +333,9 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
       } // MoveBoardToStack
 
       /// @brief This function will draw cards from the deck to
-      ///        the free slots.
-      void DrawCards()
+      ///        the free slots. Only "ApplyMove" should call this so the
+      ///        draw can be undone.
+      void DrawCardsNow()
       {
          // The amount we want to draw. This will be 3 unless it is a
          // "draw_one_game" then it will get changed later.
@@ -359,7 +353,7 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
             // move the cards.
             //
             // NOTE: This will trigger even if a draw one game is played.
-            Pile<PolarStandardPlayingCard> temp;
+            Pile<PackedPolarStandardPlayingCard> temp;
 
             // While the free cards are not empty push them back
             // and flip them back over.
@@ -389,8 +383,10 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
          // Finally if the deck is not empty...
          if (!deck.GetDeck().empty())
          {
-            // Draw the amount of cards we determined.
-            for (int i = 0; i < draw_amount; i++)
+            // Draw the amount of cards we determined. A turned over deck
+            // can have less than three.
+            draw_amount = std::min(draw_amount, deck.GetDeck().size());
+            for (size_t i = 0; i < draw_amount; i++)
             {
                // Draw the card.
                free.push_back(std::move(deck.DrawOne()));
@@ -402,7 +398,20 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
                }
             }
          }
-      } // DrawCards
+      } // DrawCardsNow
+
+      /// @brief Draw cards from the deck to the free slots as a move.
+      void DrawCards()
+      {
+         TRACE_SCOPE("Klondike::DrawCards");
+
+         // There is nothing to draw or turn over.
+         if (deck.GetDeck().empty() && free.empty())
+         {
+            return;
+         }
+         MakeMove({MovePlace::stock, 0, MovePlace::waste, 0, 1});
+      }
 
       /// @brief Prompt the user for input. Pretty simple 
       ///        but this is complicated.
@@ -420,6 +429,7 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
                       << "Type \"draw\" to draw a card, "
                       << "\"auto\" to auto fill the stacks, "
                       << "\"move\" to move cards,\n"
+                      << " \"undo\" to take back a move,"
                       << " \"stop\" to reset your inputs, "
                       << "or \"exit\" to quit/give-up. " ;
             std::cin >> input1;
@@ -427,6 +437,7 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
          while (input1 != "draw" && input1 != "d" && 
                 input1 != "auto" && input1 != "a" && 
                 input1 != "move" && input1 != "m" &&
+                input1 != "undo" && input1 != "u" &&
                 input1 != "exit" && input1 != "e" &&
                 input1 != "stop" && input1 != "s");
 
@@ -434,6 +445,7 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
          // anymore.
          if (input1 == "draw" || input1 == "d" ||
              input1 == "auto" || input1 == "a" ||
+             input1 == "undo" || input1 == "u" ||
              input1 == "exit" || input1 == "e" ||
              input1 == "stop" || input1 == "s")
          {
@@ -602,13 +614,21 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
          {
             AutoMove();
          }
+         else if (input1 == "undo" || input1 == "u")
+         {
+            if (!UndoLastMove())
+            {
+               std::cout << "There are no moves to undo!\n";
+               std::cin.get();
+            }
+         }
          else if (input1 == "move" || input1 == "m")
          {
             if (input2 == "free" || input2 == "f")
             {
                if (input3 == "stack" && !free.empty())
                {
-                  MoveFreeToStack(free.back()->GetSuit(), false);
+                  MoveFreeToStack(free.back()->GetSuitType(), false);
                }
                else if (!free.empty())
                {
@@ -627,7 +647,7 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
                if (!stacks[stack_suit].empty())
                {
                   size_t pile = Util::CStrToInt(input4);
-                  MoveStackToBoard(pile,input3);
+                  MoveStackToBoard(pile, static_cast<Suit>(stack_suit));
                }
                else
                {
@@ -641,7 +661,7 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
                if (input3 == "stack" && !board[pile1 - 1].empty())
                {
                   MoveBoardToStack(pile1, 
-                                   board[pile1 - 1].back()->GetSuit(),
+                                   board[pile1 - 1].back()->GetSuitType(),
                                    false);
                }
                else if (!board[pile1 - 1].empty())
@@ -665,109 +685,180 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
 
       /// @brief Since the free cards are important and dynamic it needs its
       ///        own function to get it's graphics.
-      /// @return Returns a vector of strings which is the graphics
-      ///         for this part.
-      std::vector<std::string> FreeCardsGraphic()
+      /// @param frame The frame to add the row to.
+      /// @param row The row of the card graphics.
+      void FreeCardsGraphic(FrameBuffer& frame, const size_t row) const
       {
-         // Get the "out" variable ready.
-         std::vector<std::string> out;
-
          // Now get the graphics for the cards that have been 
          // free.
          if (!free.empty() && free.back()->GetFaceUp())
          {
-            // Get the first card.
-            out = free.back()->GetGraphic();
-
-            // If there are two free cards get the next one.
+            // How many cards under the top one show their left edge.
+            size_t under = 0;
             if (free.size() > 1 && free[free.size() - 2]->GetFaceUp())
             {
-               for (size_t i = 0; i < out.size(); i++)
+               under++;
+               if (free.size() > 2 && free[free.size() - 3]->GetFaceUp())
                {
-                  std::string graphic = free[free.size() - 2]->GetGraphic().at(i);
-                  out[i].insert(0, Util::UTF8SubStr(graphic, 4));
+                  under++;
                }
             }
 
-            // If there is a third card add it's graphic too.
-            if (free.size() > 2 && free[free.size() - 3]->GetFaceUp())
+            // The lowest card goes first with just its left edge showing.
+            for (size_t i = under; i > 0; i--)
             {
-               for (size_t i = 0; i < out.size(); i++)
-               {
-                  std::string graphic = free[free.size() - 3]->GetGraphic().at(i);
-                  out[i].insert(0, Util::UTF8SubStr(graphic, 4));
-               }
+               frame.Append(Util::UTF8SubStr(
+                  free[free.size() - 1 - i]->GetGraphic()[row], 4));
             }
+            // Then the whole top card.
+            frame.Append(free.back()->GetGraphic()[row]);
 
             // Lastly add spaces till we make it to the stacks.
-            size_t spaces = 30 - out[0].length();
-            for (size_t i = 0; i < out.size(); i++)
-            {
-               for (size_t j = 0; j < spaces; j++)
-               {
-                  out[i].append(" ");
-               }
-            }
+            frame.Append(30 - 13 - 4 * under, ' ');
          }
          else
          {
             // Else just add the spaces.
-            for (int i = 0; i < 9; i++)
+            frame.Append(30, ' ');
+         }
+      } // FreeCardsGraphic
+
+      /// @brief This function adds the top row which is particular to the
+      ///        game being played to the frame.
+      /// @param frame The frame to add the rows to.
+      void TopRowGraphic(FrameBuffer& frame)
+      {
+         for (size_t row = 0; row < CardGraphicsAndInfo::graphic_rows; row++)
+         {
+            // Get the deck space graphic.
+            if (deck.GetDeck().empty())
             {
-               out.push_back("                              ");
+               frame.Append(CardGraphicsAndInfo::empty[row]);
             }
+            else
+            {
+               frame.Append(CardGraphicsAndInfo::back[row]);
+            }
+
+            // Add two spaces.
+            frame.Append("  ");
+
+            // Add the free card graphics.
+            FreeCardsGraphic(frame, row);
+
+            // Add the stack graphics.
+            AddStackGraphics(frame, row);
+            frame.EndRow();
          }
+      } // TopRowGraphic
+      // ----------------------------------------------------------------------
 
-         // Return the graphic.
-         return out;
-      } // FreeCardsGraphic
+   public:
+      // ----------------------------------------------------------------------
+      // Get block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Get whether one card is drawn at a time instead of three.
+      /// @return True for a draw one game.
+      bool GetDrawOne() const { return draw_one_game; }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Set block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Set whether one card is drawn at a time instead of three.
+      /// @param draw_one True for a draw one game.
+      void SetDrawOne(const bool draw_one) { draw_one_game = draw_one; }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Function block.
+      // ----------------------------------------------------------------------
 
-      /// @brief This function gets the top row which is particular to the
-      ///        game being played. 
-      /// @return Returns the string vector of the graphics all from the top
-      ///         row of cards.
-      std::vector<std::string> TopRowGraphic()
+      /// @brief Deal from a seed. The same seed is always the same deal. The
+      ///        deck is put in the same order as the Freecell deal with that
+      ///        number and then dealt the Klondike way.
+      /// @param seed The seed.
+      void DealBySeed(const uint32_t seed)
       {
-         // Initialize output.
-         std::vector<std::string> out;
+         // Get the cards in the order they are dealt.
+         uint8_t order[52];
+         MicrosoftDeals::Deal(seed, order);
 
-         // Get the deck space graphic.
-         if (deck.GetDeck().empty())
+         // Cards are drawn from the back so put them in backwards.
+         Pile<PackedPolarStandardPlayingCard> cards;
+         for (size_t i = 52; i > 0; i--)
          {
-            out = CardGraphicsAndInfo::empty;
+            cards.push_back(
+               PackedPolarStandardPlayingCard::FromId(order[i - 1]));
          }
-         else
+         deck.SetDeck(cards);
+         DealDeck();
+      }
+
+      /// @brief Make a move straight on the piles without any checks or
+      ///        strings. A face down card left on top of a column is
+      ///        flipped. A draw turns the free cards back over into the deck
+      ///        first if the deck is empty, just like "DrawCards".
+      /// @param move The move. It must be legal. "flipped" and
+      ///             "waste_before" are filled in.
+      void ApplyMove(Move& move)
+      {
+         move.flipped = false;
+         move.waste_before = static_cast<uint8_t>(free.size());
+
+         if (move.from == MovePlace::stock)
          {
-            out = CardGraphicsAndInfo::back;
+            for (size_t i = 0; i < move.amount; i++)
+            {
+               DrawCardsNow();
+            }
+            return;
          }
 
-         // Add two spaces.
-         for (size_t i = 0; i < out.size(); i++)
+         Pile<PackedPolarStandardPlayingCard>& from =
+            GetMovePile(move.from, move.from_index);
+         MoveCards(from, GetMovePile(move.to, move.to_index), move.amount);
+         if (move.from == MovePlace::column && !from.empty() &&
+             !from.back()->GetFaceUp())
          {
-            out[i].append("  ");
+            from.back()->FlipCard();
+            move.flipped = true;
          }
+      }
 
-         // Add the free card graphics.
-         std::vector<std::string> temp = FreeCardsGraphic();
-         for (size_t i = 0; i < out.size(); i++)
+      /// @brief Take back a move that was just made.
+      /// @param move The move as it was filled in by "ApplyMove".
+      void UndoMove(const Move& move)
+      {
+         if (move.from == MovePlace::stock)
          {
-            out[i].append(temp[i]);
+            // Drawing and turning the free cards over never change the order
+            // of the free cards followed by the deck from the top down. So
+            // just move cards across until the free pile is the size it was.
+            while (free.size() > move.waste_before)
+            {
+               free.back()->FlipCard();
+               deck.PutBack(std::move(free.back()));
+               free.pop_back();
+            }
+            while (free.size() < move.waste_before)
+            {
+               free.push_back(deck.DrawOne());
+               free.back()->FlipCard();
+            }
+            return;
          }
 
-         // Add the stack graphics.
-         AddStackGraphics(out, 0);
-         AddStackGraphics(out, 1);
-         AddStackGraphics(out, 2);
-         AddStackGraphics(out, 3);
-
-         return out;
-      } // TopRowGraphic
-      // ----------------------------------------------------------------------
-
-   public:
-      // ----------------------------------------------------------------------
-      // Public Function block.
-      // ----------------------------------------------------------------------
+         Pile<PackedPolarStandardPlayingCard>& from =
+            GetMovePile(move.from, move.from_index);
+         if (move.flipped)
+         {
+            from.back()->FlipCard();
+         }
+         MoveCards(GetMovePile(move.to, move.to_index), from, move.amount);
+      }
 
       // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - 
       // Game!! Must be at the end since it has everything.
@@ -795,17 +886,26 @@ class Klondike: public Solitaire<PolarStandardPlayingCard>
             draw_one_game = true;
          }
 
-         // Whether to start the game or not.
+         // Whether to start the game or not. A number picks that deal.
          std::string start;
          do
          {
-            std::cout << "Type \"start\" to start. ";
+            std::cout << "Type \"start\" to start or a seed to play that"
+                      << " deal. ";
             std::cin >> start;
          } 
-         while (start != "start");
+         while (start != "start" &&
+                start.find_first_not_of("0123456789") != std::string::npos);
 
          // Deal the cards.
-         Deal();
+         if (start == "start")
+         {
+            Deal();
+         }
+         else
+         {
+            DealBySeed(std::strtoul(start.c_str(), nullptr, 10));
+         }
 
          // This is the bread and butter.
          // First we print the screen then checck the win condition
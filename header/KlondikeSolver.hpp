@@ -0,0 +1,1316 @@
+#ifndef KLONDIKESOLVER_HPP
+#define KLONDIKESOLVER_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <algorithm>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+// Utility File includes.
+// The mixer used to make the hash keys, and the generator for the guesses
+// and rollouts.
+#include "Random.h"
+
+// Regular File includes.
+// This is the header file for the "Klondike" class.
+#include "Klondike.hpp"
+// The moves shared by every solitaire game.
+#include "Move.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Namespace block.
+// ----------------------------------------------------------------------------
+
+/// @brief Adding a solver to the solitaire family of games.
+namespace Solitaire
+{
+// ----------------------------------------------------------------------------
+// Type Declarations block.
+// ----------------------------------------------------------------------------
+
+/// @brief How a solve finished.
+enum class KlondikeSolveStatus
+{
+   // A solution was found.
+   solved,
+   // Every position the search makes was tried and none of them win. The
+   // search leaves out run splits that rarely help, so this does not prove
+   // the deal can't be won.
+   exhausted,
+   // The node budget ran out first.
+   gave_up
+};
+
+/// @brief What a full information solve found.
+struct KlondikeSolveResult
+{
+   KlondikeSolveStatus       status = KlondikeSolveStatus::gave_up;
+   // The amount of positions searched.
+   uint64_t                  nodes  = 0;
+   // The amount of moves in the solution. 0 unless solved.
+   size_t                    length = 0;
+   // The moves that win, including the automatic ones.
+   std::vector<Move>         moves;
+};
+
+/// @brief How a game played without seeing the face down cards went.
+struct KlondikePlayResult
+{
+   bool   won   = false;
+   // The amount of moves made, including the automatic ones.
+   size_t moves = 0;
+   // The amount of cards that made it to the foundations.
+   size_t home  = 0;
+};
+
+/// @brief Settings for playing without seeing the face down cards.
+struct KlondikeRealisticSettings
+{
+   // The amount of guesses at the hidden cards for each choice.
+   size_t samples       = 8;
+   // How many moves each rollout plays before it is scored.
+   size_t rollout_moves = 60;
+   // Give up on the game after this many moves.
+   size_t max_moves     = 1000;
+};
+
+/// @brief A klondike position in one flat block so it is cheap to copy and
+///        to change in place.
+struct KlondikePosition
+{
+   // A column can hold at most six face down cards plus a run of thirteen.
+   static constexpr size_t column_capacity = 20;
+
+   // The columns. The last card of each is the top.
+   PackedPolarStandardPlayingCard columns[7][column_capacity];
+   uint8_t                        lengths[7]     = {0, 0, 0, 0, 0, 0, 0};
+   // The stock. The last card is the next one drawn.
+   PackedPolarStandardPlayingCard stock[24];
+   uint8_t                        stock_count    = 0;
+   // The waste. The last card is the one that can be played.
+   PackedPolarStandardPlayingCard waste[24];
+   uint8_t                        waste_count    = 0;
+   // The top rank on each foundation, by suit index. 0 is empty.
+   uint8_t                        foundations[4] = {0, 0, 0, 0};
+   // The amount of cards turned over by a draw. 1 or 3.
+   uint8_t                        draw_count     = 3;
+   // One bit per card id for the cards the player has seen. Only used when
+   // playing without seeing the face down cards.
+   uint64_t                       seen           = 0;
+
+   /// @brief Copy a position from a game.
+   /// @param game The game.
+   void Load(const Klondike& game)
+   {
+      const auto& board = game.GetBoard();
+      for (size_t i = 0; i < 7; i++)
+      {
+         lengths[i] = 0;
+         if (i < board.size())
+         {
+            for (const auto& card : board[i])
+            {
+               columns[i][lengths[i]++] = card;
+            }
+         }
+      }
+      stock_count = 0;
+      for (const auto& card : game.GetDeck().GetDeck())
+      {
+         stock[stock_count++] = card;
+      }
+      waste_count = 0;
+      for (const auto& card : game.GetFree())
+      {
+         waste[waste_count++] = card;
+      }
+      const auto& stacks = game.GetStacks();
+      for (size_t i = 0; i < 4; i++)
+      {
+         foundations[i] = i < stacks.size() ? stacks[i].size() : 0;
+      }
+      draw_count = game.GetDrawOne() ? 1 : 3;
+      seen = 0;
+      MarkVisibleSeen();
+   }
+
+   /// @brief Deal 52 cards the way "Klondike::DealBySeed" does.
+   /// @param order The card ids in the order they are drawn from the deck.
+   /// @param draw_count_input The amount of cards turned over by a draw.
+   void LoadDeal(const uint8_t* order, const uint8_t draw_count_input)
+   {
+      size_t next = 0;
+      for (size_t i = 0; i < 7; i++)
+      {
+         lengths[i] = 0;
+         for (size_t j = 0; j <= i; j++)
+         {
+            columns[i][lengths[i]++] =
+               PackedPolarStandardPlayingCard(order[next] % 13 + 1,
+                                              size_t(order[next] / 13),
+                                              i == j);
+            next++;
+         }
+      }
+      stock_count = 0;
+      for (size_t i = 52; i > next; i--)
+      {
+         stock[stock_count++] = PackedPolarStandardPlayingCard::FromId(
+                                   order[i - 1]);
+      }
+      waste_count = 0;
+      for (size_t i = 0; i < 4; i++)
+      {
+         foundations[i] = 0;
+      }
+      draw_count = draw_count_input;
+      seen = 0;
+      MarkVisibleSeen();
+   }
+
+   /// @brief Mark every face up card and the waste as seen.
+   void MarkVisibleSeen()
+   {
+      for (size_t i = 0; i < 7; i++)
+      {
+         for (size_t j = 0; j < lengths[i]; j++)
+         {
+            if (columns[i][j].GetFaceUp())
+            {
+               seen |= uint64_t(1) << columns[i][j].GetId();
+            }
+         }
+      }
+      for (size_t i = 0; i < waste_count; i++)
+      {
+         seen |= uint64_t(1) << waste[i].GetId();
+      }
+   }
+
+   /// @brief Get the top card of a column. The column must not be empty.
+   /// @param column The column.
+   /// @return The top card.
+   PackedPolarStandardPlayingCard Top(const size_t column) const
+   {
+      return columns[column][lengths[column] - 1];
+   }
+
+   /// @brief Check if a card can go on another card in a column.
+   /// @param card The card being moved.
+   /// @param onto The card it would go on.
+   /// @return True if the rank is one lower and the colour is different.
+   static bool CanPlaceOn(const PackedStandardPlayingCard card,
+                          const PackedStandardPlayingCard onto)
+   {
+      return onto.GetRank() == card.GetRank() + 1 &&
+             ((onto.GetSuitIndex() ^ card.GetSuitIndex()) & 1);
+   }
+
+   /// @brief Check if a card can go on its foundation.
+   /// @param card The card.
+   /// @return True if it is the next rank for its suit.
+   bool CanFound(const PackedStandardPlayingCard card) const
+   {
+      return foundations[card.GetSuitIndex()] + 1 == card.GetRank();
+   }
+
+   /// @brief Check if a card can go on a column. Only kings go on empty
+   ///        columns.
+   /// @param card The card.
+   /// @param column The column.
+   /// @return True if it fits.
+   bool CanPlaceOnColumn(const PackedStandardPlayingCard card,
+                         const size_t                    column) const
+   {
+      return lengths[column] == 0 ? card.GetRank() == 13
+                                  : CanPlaceOn(card, Top(column));
+   }
+
+   /// @brief Check if every card is on the foundations.
+   /// @return True if the game is won. False otherwise.
+   bool Won() const
+   {
+      return foundations[0] == 13 && foundations[1] == 13 &&
+             foundations[2] == 13 && foundations[3] == 13;
+   }
+
+   /// @brief Count the cards on the foundations.
+   /// @return The amount.
+   size_t Home() const
+   {
+      return foundations[0] + foundations[1] + foundations[2] +
+             foundations[3];
+   }
+
+   /// @brief Count the face down cards on the board.
+   /// @return The amount.
+   size_t FaceDown() const
+   {
+      size_t out = 0;
+      for (size_t i = 0; i < 7; i++)
+      {
+         for (size_t j = 0; j < lengths[i] && !columns[i][j].GetFaceUp(); j++)
+         {
+            out++;
+         }
+      }
+      return out;
+   }
+
+   /// @brief Find how big the waste is after some draws. A draw turns the
+   ///        waste back over first if the stock is empty, just like
+   ///        "Klondike::DrawCards".
+   /// @param draws The amount of draws.
+   /// @return The amount of cards in the waste.
+   size_t WasteAfterDraws(const size_t draws) const
+   {
+      size_t left = stock_count;
+      size_t shown = waste_count;
+      for (size_t i = 0; i < draws; i++)
+      {
+         if (left == 0)
+         {
+            left = shown;
+            shown = 0;
+         }
+         size_t amount = std::min<size_t>(draw_count, left);
+         left -= amount;
+         shown += amount;
+      }
+      return shown;
+   }
+
+   /// @brief Get a card from the stock and waste as one line, the waste from
+   ///        the bottom up and then the stock from the top down. Draws and
+   ///        turning the waste over never change this line, they only move
+   ///        where it is split.
+   /// @param index The place in the line.
+   /// @return The card.
+   PackedPolarStandardPlayingCard StockLine(const size_t index) const
+   {
+      return index < waste_count ? waste[index]
+                                 : stock[stock_count - 1 -
+                                         (index - waste_count)];
+   }
+
+   /// @brief Move cards between the top of the stock and the top of the
+   ///        waste until the waste has a given size.
+   /// @param target The size.
+   void ShiftWaste(const size_t target)
+   {
+      while (waste_count > target)
+      {
+         stock[stock_count] = waste[--waste_count];
+         stock[stock_count++].FlipCard();
+      }
+      while (waste_count < target)
+      {
+         waste[waste_count] = stock[--stock_count];
+         waste[waste_count].FlipCard();
+         seen |= uint64_t(1) << waste[waste_count].GetId();
+         waste_count++;
+      }
+   }
+
+   /// @brief Make a move. It must be legal. Fills in "flipped" and
+   ///        "waste_before" so the move can be taken back.
+   /// @param move The move.
+   void Apply(Move& move)
+   {
+      move.flipped = false;
+      move.waste_before = waste_count;
+
+      if (move.from == MovePlace::stock)
+      {
+         ShiftWaste(WasteAfterDraws(move.amount));
+         return;
+      }
+
+      // Pick the cards up.
+      PackedPolarStandardPlayingCard hand[13];
+      if (move.from == MovePlace::column)
+      {
+         lengths[move.from_index] -= move.amount;
+         for (size_t i = 0; i < move.amount; i++)
+         {
+            hand[i] = columns[move.from_index][lengths[move.from_index] + i];
+         }
+         // Turn over what is under them.
+         if (lengths[move.from_index] > 0 &&
+             !Top(move.from_index).GetFaceUp())
+         {
+            PackedPolarStandardPlayingCard& under =
+               columns[move.from_index][lengths[move.from_index] - 1];
+            under.FlipCard();
+            seen |= uint64_t(1) << under.GetId();
+            move.flipped = true;
+         }
+      }
+      else if (move.from == MovePlace::waste)
+      {
+         hand[0] = waste[--waste_count];
+      }
+      else
+      {
+         hand[0] = PackedPolarStandardPlayingCard(
+                      foundations[move.from_index]--,
+                      size_t(move.from_index), true);
+      }
+
+      // Put them down.
+      if (move.to == MovePlace::column)
+      {
+         for (size_t i = 0; i < move.amount; i++)
+         {
+            columns[move.to_index][lengths[move.to_index]++] = hand[i];
+         }
+      }
+      else
+      {
+         foundations[move.to_index]++;
+      }
+   }
+
+   /// @brief Take back a move that was just made.
+   /// @param move The move as it was filled in by "Apply".
+   void Undo(const Move& move)
+   {
+      if (move.from == MovePlace::stock)
+      {
+         ShiftWaste(move.waste_before);
+         return;
+      }
+
+      // Pick the cards back up from where they went.
+      PackedPolarStandardPlayingCard hand[13];
+      if (move.to == MovePlace::column)
+      {
+         lengths[move.to_index] -= move.amount;
+         for (size_t i = 0; i < move.amount; i++)
+         {
+            hand[i] = columns[move.to_index][lengths[move.to_index] + i];
+         }
+      }
+      else
+      {
+         hand[0] = PackedPolarStandardPlayingCard(
+                      foundations[move.to_index]--,
+                      size_t(move.to_index), true);
+      }
+
+      // Put them back where they came from.
+      if (move.from == MovePlace::column)
+      {
+         if (move.flipped)
+         {
+            columns[move.from_index][lengths[move.from_index] - 1]
+               .FlipCard();
+         }
+         for (size_t i = 0; i < move.amount; i++)
+         {
+            columns[move.from_index][lengths[move.from_index]++] = hand[i];
+         }
+      }
+      else if (move.from == MovePlace::waste)
+      {
+         waste[waste_count++] = hand[0];
+      }
+      else
+      {
+         foundations[move.from_index]++;
+      }
+   }
+
+   /// @brief Write the legal moves. The search only wants the moves worth
+   ///        making, so it can leave some of them out with the flags below.
+   /// @param out Where the moves go. Must have room for "max_legal_moves".
+   /// @param from_foundations Whether to include taking cards back off the
+   ///                         foundations.
+   /// @param look_through_stock Whether to look at every card the draws can
+   ///                           reach and offer the draws that lead to one
+   ///                           that can be played. This needs every card
+   ///                           to be known. Otherwise a single draw is
+   ///                           offered.
+   /// @param every_split Whether to split runs anywhere. Otherwise a run is
+   ///                    only split if the card it leaves on top can go
+   ///                    home.
+   /// @param every_empty Whether kings go to every empty column, even from
+   ///                    the bottom of another column. Otherwise they only
+   ///                    go to the first empty column, since any other is
+   ///                    the same move, and never from the bottom of one.
+   /// @return The amount of moves written.
+   size_t GenerateMoves(Move*      out,
+                        const bool from_foundations = true,
+                        const bool look_through_stock = false,
+                        const bool every_split = true,
+                        const bool every_empty = true) const
+   {
+      size_t count = 0;
+
+      // The first empty column. Without "every_empty" moving a king to any
+      // other empty column is left out as the same move.
+      size_t empty = 7;
+      for (size_t i = 0; i < 7 && empty == 7; i++)
+      {
+         if (lengths[i] == 0)
+         {
+            empty = i;
+         }
+      }
+
+      // Anything that can go to the foundations.
+      if (waste_count > 0 && CanFound(waste[waste_count - 1]))
+      {
+         out[count++] = {MovePlace::waste, 0, MovePlace::foundation,
+                         uint8_t(waste[waste_count - 1].GetSuitIndex()), 1};
+      }
+      for (size_t i = 0; i < 7; i++)
+      {
+         if (lengths[i] > 0 && CanFound(Top(i)))
+         {
+            out[count++] = {MovePlace::column, uint8_t(i),
+                            MovePlace::foundation,
+                            uint8_t(Top(i).GetSuitIndex()), 1};
+         }
+      }
+
+      // Face up runs onto other columns.
+      for (size_t from = 0; from < 7; from++)
+      {
+         for (size_t start = 0; start < lengths[from]; start++)
+         {
+            PackedPolarStandardPlayingCard card = columns[from][start];
+            if (!card.GetFaceUp())
+            {
+               continue;
+            }
+            uint8_t amount = uint8_t(lengths[from] - start);
+            // Moving a whole run always turns a card over or empties the
+            // column. Splitting one often does nothing useful.
+            if (!every_split && start > 0 &&
+                columns[from][start - 1].GetFaceUp() &&
+                !CanFound(columns[from][start - 1]))
+            {
+               continue;
+            }
+            for (size_t to = 0; to < 7; to++)
+            {
+               if (to == from ||
+                   (lengths[to] == 0 && to != empty && !every_empty))
+               {
+                  continue;
+               }
+               // A king that is already at the bottom has nowhere better
+               // to be.
+               if (lengths[to] == 0 && start == 0 && !every_empty)
+               {
+                  continue;
+               }
+               if (CanPlaceOnColumn(card, to))
+               {
+                  out[count++] = {MovePlace::column, uint8_t(from),
+                                  MovePlace::column, uint8_t(to),
+                                  amount};
+               }
+            }
+         }
+      }
+
+      // The waste onto the columns.
+      if (waste_count > 0)
+      {
+         for (size_t to = 0; to < 7; to++)
+         {
+            if ((lengths[to] > 0 || to == empty || every_empty) &&
+                CanPlaceOnColumn(waste[waste_count - 1], to))
+            {
+               out[count++] = {MovePlace::waste, 0, MovePlace::column,
+                               uint8_t(to), 1};
+            }
+         }
+      }
+
+      // Cards back off the foundations. Like the game, never onto an empty
+      // column.
+      for (size_t suit = 0; suit < 4 && from_foundations; suit++)
+      {
+         if (foundations[suit] == 0)
+         {
+            continue;
+         }
+         PackedStandardPlayingCard card(foundations[suit], suit);
+         for (size_t to = 0; to < 7; to++)
+         {
+            if (lengths[to] > 0 && CanPlaceOn(card, Top(to)))
+            {
+               out[count++] = {MovePlace::foundation, uint8_t(suit),
+                               MovePlace::column, uint8_t(to), 1};
+            }
+         }
+      }
+
+      // Last of all, the draws.
+      if (stock_count == 0 && waste_count == 0)
+      {
+         return count;
+      }
+      if (!look_through_stock)
+      {
+         out[count++] = {MovePlace::stock, 0, MovePlace::waste, 0, 1};
+         return count;
+      }
+
+      // Drawing only changes where the line of stock and waste cards is
+      // split, so keep drawing until a split comes up a second time.
+      bool reached[25] = {};
+      reached[waste_count] = true;
+      size_t left = stock_count;
+      size_t shown = waste_count;
+      for (size_t draws = 1; ; draws++)
+      {
+         if (left == 0)
+         {
+            left = shown;
+            shown = 0;
+         }
+         size_t amount = std::min<size_t>(draw_count, left);
+         left -= amount;
+         shown += amount;
+         if (reached[shown])
+         {
+            break;
+         }
+         reached[shown] = true;
+
+         // Only offer it if the new top card can go somewhere.
+         PackedPolarStandardPlayingCard card = StockLine(shown - 1);
+         bool playable = CanFound(card);
+         for (size_t to = 0; to < 7 && !playable; to++)
+         {
+            playable = (lengths[to] > 0 || to == empty) &&
+                       CanPlaceOnColumn(card, to);
+         }
+         if (playable)
+         {
+            out[count++] = {MovePlace::stock, 0, MovePlace::waste, 0,
+                            uint8_t(draws)};
+         }
+      }
+      return count;
+   } // GenerateMoves
+
+   /// @brief Guess the cards the player hasn't seen. Every card that hasn't
+   ///        been seen and isn't home is shuffled between the face down
+   ///        slots and stock slots that hold unseen cards.
+   /// @param rng The generator for the guess. Any "Random::Below" takes.
+   template<typename Generator>
+   void Determinize(Generator& rng)
+   {
+      PackedPolarStandardPlayingCard* slots[52];
+      PackedPolarStandardPlayingCard  cards[52];
+      size_t count = 0;
+      for (size_t i = 0; i < 7; i++)
+      {
+         for (size_t j = 0; j < lengths[i]; j++)
+         {
+            if (!(seen >> columns[i][j].GetId() & 1))
+            {
+               slots[count] = &columns[i][j];
+               cards[count++] = columns[i][j];
+            }
+         }
+      }
+      for (size_t i = 0; i < stock_count; i++)
+      {
+         if (!(seen >> stock[i].GetId() & 1))
+         {
+            slots[count] = &stock[i];
+            cards[count++] = stock[i];
+         }
+      }
+
+      // Shuffle the cards and put them back face down.
+      Random::Shuffle(cards, cards + count, rng);
+      for (size_t i = 0; i < count; i++)
+      {
+         *slots[i] = PackedPolarStandardPlayingCard::FromId(cards[i].GetId());
+      }
+   }
+};
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief Solves klondike deals, draw one or draw three, in two ways.
+///
+///        "SolveThoughtful" sees every card, which is the game known as
+///        thoughtful solitaire. It is a depth first search like the
+///        freecell solver, with moves tried best first, safe cards sent
+///        home automatically and seen positions kept in a fixed size table
+///        of hashes. Positions are small so they are hashed from scratch.
+///        Columns are hashed on their own and summed so their order doesn't
+///        matter. Runs are only split when that lets a card go home, so
+///        running out of positions is not a proof that a deal is lost.
+///
+///        "PlayRealistic" only sees what a player would. Before each choice
+///        it guesses the hidden cards a few times. For each guess it plays
+///        every candidate move followed by a short greedy rollout and
+///        scores where that ends up. The move with the best total is made
+///        on the real game, which may turn up new cards. Positions already
+///        played are never gone back to so a game always ends.
+///
+///        "EstimateWinRate" plays a deal many times that way and gives the
+///        fraction won, which is a good measure of how hard a deal is.
+class KlondikeSolver
+{
+   private:
+      // ----------------------------------------------------------------------
+      // Private Variables block.
+      // ----------------------------------------------------------------------
+
+      /// @brief The random keys for every card in every place.
+      struct Keys
+      {
+         // Columns use the card id plus 52 when face up.
+         uint64_t column[KlondikePosition::column_capacity][104];
+         uint64_t stock[24][52];
+         uint64_t waste[24][52];
+         uint64_t foundation[4][14];
+
+         Keys()
+         {
+            uint64_t counter = 0x6b6c6f6e64696b65ULL;
+            for (auto& position_keys : column)
+            {
+               for (auto& key : position_keys)
+               {
+                  key = Random::SplitMix64(counter++);
+               }
+            }
+            for (size_t i = 0; i < 24; i++)
+            {
+               for (size_t j = 0; j < 52; j++)
+               {
+                  stock[i][j] = Random::SplitMix64(counter++);
+                  waste[i][j] = Random::SplitMix64(counter++);
+               }
+            }
+            for (auto& suit_keys : foundation)
+            {
+               for (auto& key : suit_keys)
+               {
+                  key = Random::SplitMix64(counter++);
+               }
+            }
+         }
+      };
+
+      /// @brief Get the keys. They are made once and shared by all solvers.
+      /// @return The keys.
+      static const Keys& GetKeys()
+      {
+         static const Keys keys;
+         return keys;
+      }
+
+      /// @brief Where the search is in one position.
+      struct Frame
+      {
+         // The moves for this position are buffer[first] to buffer[last].
+         size_t first;
+         size_t last;
+         // The next move to try.
+         size_t next;
+         // The length of "path" at this position.
+         size_t mark;
+      };
+
+      // The position being searched.
+      KlondikePosition          position;
+      // The seen table. Each slot holds a salted hash or 0.
+      std::vector<uint64_t>     table;
+      // The salt for the current solve.
+      uint64_t                  salt = 0;
+      // The amount of solves so far. Used to make the salt.
+      uint64_t                  solves = 0;
+      // The moves from the start to "position".
+      std::vector<Move>         path;
+      // The moves to try at every depth, one depth after another.
+      std::vector<Move>         buffer;
+      // The amount of "buffer" in use. The rest is room to write into.
+      size_t                    buffer_used = 0;
+      // Scratch space for putting moves in order.
+      std::vector<std::pair<int, Move>> ranked;
+      // The positions on the current path that still have moves to try.
+      std::vector<Frame>        frames;
+      // The amount of positions searched and the most allowed.
+      uint64_t                  nodes     = 0;
+      uint64_t                  max_nodes = 0;
+      // Whether the search was cut short by "max_nodes".
+      bool                      ran_out   = false;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Private Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Hash a position. Positions that only differ by the order of
+      ///        the columns hash the same.
+      /// @param from The position.
+      /// @return The hash.
+      static uint64_t Hash(const KlondikePosition& from)
+      {
+         const Keys& keys = GetKeys();
+         uint64_t out = 0;
+         for (size_t i = 0; i < 7; i++)
+         {
+            uint64_t column = 0;
+            for (size_t j = 0; j < from.lengths[i]; j++)
+            {
+               const PackedPolarStandardPlayingCard card = from.columns[i][j];
+               column ^= keys.column[j][card.GetId() +
+                                        (card.GetFaceUp() ? 52 : 0)];
+            }
+            out += Random::SplitMix64(column);
+         }
+         for (size_t i = 0; i < from.stock_count; i++)
+         {
+            out ^= keys.stock[i][from.stock[i].GetId()];
+         }
+         for (size_t i = 0; i < from.waste_count; i++)
+         {
+            out ^= keys.waste[i][from.waste[i].GetId()];
+         }
+         for (size_t i = 0; i < 4; i++)
+         {
+            out ^= keys.foundation[i][from.foundations[i]];
+         }
+         return out;
+      }
+
+      /// @brief Check if a card can never be needed on the board again.
+      /// @param from The position.
+      /// @param card The card.
+      /// @return True if it is safe to put on its foundation.
+      static bool SafeToFound(const KlondikePosition&         from,
+                              const PackedStandardPlayingCard card)
+      {
+         if (!from.CanFound(card))
+         {
+            return false;
+         }
+         int    rank  = card.GetRank();
+         size_t other = (card.GetSuitIndex() & 1) ^ 1;
+         return rank <= 2 ||
+                (from.foundations[other] + 1 >= rank &&
+                 from.foundations[other + 2] + 1 >= rank);
+      }
+
+      /// @brief Move every safe card to the foundations.
+      /// @param from The position to change.
+      /// @param moves Where the moves made go.
+      static void AutoPlay(KlondikePosition&  from,
+                           std::vector<Move>& moves)
+      {
+         bool moved = true;
+         while (moved)
+         {
+            moved = false;
+            if (from.waste_count > 0 &&
+                SafeToFound(from, from.waste[from.waste_count - 1]))
+            {
+               Move move = {
+                  MovePlace::waste, 0, MovePlace::foundation,
+                  uint8_t(from.waste[from.waste_count - 1].GetSuitIndex()),
+                  1};
+               from.Apply(move);
+               moves.push_back(move);
+               moved = true;
+            }
+            for (size_t i = 0; i < 7; i++)
+            {
+               if (from.lengths[i] > 0 && from.Top(i).GetFaceUp() &&
+                   SafeToFound(from, from.Top(i)))
+               {
+                  Move move = {
+                     MovePlace::column, uint8_t(i),
+                     MovePlace::foundation,
+                     uint8_t(from.Top(i).GetSuitIndex()), 1};
+                  from.Apply(move);
+                  moves.push_back(move);
+                  moved = true;
+               }
+            }
+         }
+      }
+
+      /// @brief Score a position. Higher is closer to a win.
+      /// @param from The position.
+      /// @return The score.
+      static int Evaluate(const KlondikePosition& from)
+      {
+         int out = 16 * int(from.Home()) - 8 * int(from.FaceDown()) -
+                   2 * int(from.stock_count + from.waste_count);
+         for (size_t i = 0; i < 7; i++)
+         {
+            out += from.lengths[i] == 0 ? 2 : 0;
+         }
+         return out;
+      }
+
+      /// @brief Take back moves until "path" is a given length.
+      /// @param mark The length.
+      void PopTo(const size_t mark)
+      {
+         while (path.size() > mark)
+         {
+            position.Undo(path.back());
+            path.pop_back();
+         }
+      }
+
+      /// @brief Put the moves for a position in order, best first.
+      /// @param first The first move in "buffer".
+      /// @param last One past the last move in "buffer".
+      void OrderMoves(const size_t first, const size_t last)
+      {
+         ranked.clear();
+         for (size_t i = first; i < last; i++)
+         {
+            size_t mark = path.size();
+            Move move = buffer[i];
+            position.Apply(move);
+            path.push_back(move);
+            AutoPlay(position, path);
+            ranked.push_back({Evaluate(position), buffer[i]});
+            PopTo(mark);
+         }
+         // Stable so ties keep the order they were made in, which puts the
+         // draw last.
+         std::stable_sort(ranked.begin(), ranked.end(),
+                          [](const std::pair<int, Move>& a,
+                             const std::pair<int, Move>& b)
+                          {
+                             return a.first > b.first;
+                          });
+         for (size_t i = first; i < last; i++)
+         {
+            buffer[i] = ranked[i - first].second;
+         }
+      }
+
+      /// @brief Add the current position to the seen table.
+      /// @return True if it was new. False if it was already there.
+      bool MarkSeen()
+      {
+         const uint64_t hash = Hash(position);
+         uint64_t stored = (hash ^ salt) | 1;
+         uint64_t& slot = table[hash & (table.size() - 1)];
+         if (slot == stored)
+         {
+            return false;
+         }
+         slot = stored;
+         return true;
+      }
+
+      /// @brief Start searching the current position. If it is new its
+      ///        moves are added to "buffer" and a frame is pushed for it.
+      void Enter()
+      {
+         if (nodes >= max_nodes)
+         {
+            ran_out = true;
+            return;
+         }
+         if (!MarkSeen())
+         {
+            return;
+         }
+         nodes++;
+
+         Frame frame;
+         frame.first = buffer_used;
+         if (buffer.size() < frame.first + max_legal_moves)
+         {
+            buffer.resize(2 * buffer.size() + max_legal_moves);
+         }
+         frame.last = frame.first +
+                      position.GenerateMoves(buffer.data() + frame.first,
+                                             true, true, false, false);
+         buffer_used = frame.last;
+         OrderMoves(frame.first, frame.last);
+         frame.next = frame.first;
+         frame.mark = path.size();
+         frames.push_back(frame);
+      }
+
+      /// @brief Search from the current position with its own stack of
+      ///        frames.
+      /// @return True if it leads to a win. The winning moves are left in
+      ///         "path".
+      bool Search()
+      {
+         frames.clear();
+         if (position.Won())
+         {
+            return true;
+         }
+         Enter();
+
+         while (!frames.empty() && !ran_out)
+         {
+            Frame& frame = frames.back();
+            // Take back whatever the last move tried from here did.
+            PopTo(frame.mark);
+            if (frame.next == frame.last)
+            {
+               buffer_used = frame.first;
+               frames.pop_back();
+               continue;
+            }
+
+            Move move = buffer[frame.next++];
+            position.Apply(move);
+            path.push_back(move);
+            AutoPlay(position, path);
+            if (position.Won())
+            {
+               return true;
+            }
+            Enter();
+         }
+         return false;
+      } // Search
+
+      /// @brief Play a position forward greedily and score where it ends.
+      ///        Cards go home first, then moves that turn a card up, then
+      ///        anything from the waste, then a draw.
+      /// @param from The position. It is changed.
+      /// @param scratch Scratch space for the automatic moves.
+      /// @param length The most moves to play.
+      /// @param rng The generator used to break ties.
+      /// @return The score.
+      template<typename Generator>
+      static int Rollout(KlondikePosition&  from,
+                         std::vector<Move>& scratch,
+                         const size_t       length,
+                         Generator&         rng)
+      {
+         Move   moves[max_legal_moves];
+         size_t idle = 0;
+         for (size_t step = 0; step < length && !from.Won(); step++)
+         {
+            scratch.clear();
+            AutoPlay(from, scratch);
+            size_t count = from.GenerateMoves(moves, false, false, false,
+                                              false);
+
+            // Pick the best kind of move there is.
+            int    best_rank = -1;
+            size_t best      = 0;
+            size_t ties      = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+               const Move& move = moves[i];
+               int rank = 0;
+               if (move.to == MovePlace::foundation)
+               {
+                  rank = 4;
+               }
+               else if (move.from == MovePlace::column &&
+                        move.amount < from.lengths[move.from_index] &&
+                        !from.columns[move.from_index]
+                            [from.lengths[move.from_index] - move.amount - 1]
+                            .GetFaceUp())
+               {
+                  rank = 3;
+               }
+               else if (move.from == MovePlace::waste)
+               {
+                  rank = 2;
+               }
+               else if (move.from == MovePlace::stock)
+               {
+                  rank = 1;
+               }
+               if (rank > best_rank)
+               {
+                  best_rank = rank;
+                  best = i;
+                  ties = 1;
+               }
+               else if (rank == best_rank &&
+                        Random::Below(rng, uint32_t(++ties)) == 0)
+               {
+                  best = i;
+               }
+            }
+            if (best_rank <= 0)
+            {
+               break;
+            }
+
+            // Stop once we have gone through the whole stock with nothing
+            // but draws.
+            idle = best_rank == 1 ? idle + 1 : 0;
+            if (idle > size_t(from.stock_count + from.waste_count) /
+                          from.draw_count + 1)
+            {
+               break;
+            }
+            Move move = moves[best];
+            from.Apply(move);
+         }
+         return from.Won() ? 10000 : Evaluate(from);
+      } // Rollout
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Make a solver. The solver can be reused for many deals.
+      /// @param table_bits The seen table has 2^table_bits slots of 8 bytes.
+      explicit KlondikeSolver(const size_t table_bits = 20):
+         table(size_t(1) << table_bits, 0)
+      {
+         path.reserve(512);
+         buffer.resize(4096);
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Solve a position seeing every card.
+      /// @param start The position to start from.
+      /// @param max_nodes_input Give up after this many positions.
+      /// @param keep_moves Whether to copy the solution out.
+      /// @return What was found.
+      KlondikeSolveResult SolveThoughtful(
+         const KlondikePosition& start,
+         const uint64_t          max_nodes_input = 1000000,
+         const bool              keep_moves = true)
+      {
+         position = start;
+         salt = Random::SplitMix64(++solves);
+         path.clear();
+         buffer_used = 0;
+         nodes = 0;
+         max_nodes = max_nodes_input;
+         ran_out = false;
+
+         KlondikeSolveResult result;
+         AutoPlay(position, path);
+         if (Search())
+         {
+            result.status = KlondikeSolveStatus::solved;
+            result.length = path.size();
+            if (keep_moves)
+            {
+               result.moves = path;
+            }
+         }
+         else if (!ran_out)
+         {
+            result.status = KlondikeSolveStatus::exhausted;
+         }
+         result.nodes = nodes;
+         return result;
+      }
+
+      /// @brief Play a position seeing only what a player would.
+      /// @param start The position to start from.
+      /// @param rng The generator for the guesses. Any "Random::Below"
+      ///            takes.
+      /// @param settings How hard to think about each move.
+      /// @return How the game went.
+      template<typename Generator>
+      static KlondikePlayResult PlayRealistic(
+         const KlondikePosition&          start,
+         Generator&                       rng,
+         const KlondikeRealisticSettings& settings =
+            KlondikeRealisticSettings())
+      {
+         KlondikePosition truth = start;
+         truth.MarkVisibleSeen();
+         Move                         moves[max_legal_moves];
+         std::vector<Move>            candidates;
+         std::vector<Move>            scratch;
+         std::vector<int>             scores;
+         std::unordered_set<uint64_t> visited;
+
+         KlondikePlayResult result;
+         visited.insert(Hash(truth));
+         while (result.moves < settings.max_moves)
+         {
+            scratch.clear();
+            AutoPlay(truth, scratch);
+            result.moves += scratch.size();
+            if (truth.Won())
+            {
+               break;
+            }
+
+            // Only keep moves that go somewhere new.
+            size_t count = truth.GenerateMoves(moves, false, false, false,
+                                               false);
+            candidates.clear();
+            for (size_t i = 0; i < count; i++)
+            {
+               Move move = moves[i];
+               KlondikePosition next = truth;
+               next.Apply(move);
+               scratch.clear();
+               AutoPlay(next, scratch);
+               if (visited.count(Hash(next)) == 0)
+               {
+                  candidates.push_back(move);
+               }
+            }
+            if (candidates.empty())
+            {
+               break;
+            }
+
+            // Score each candidate against the same guesses.
+            size_t choice = 0;
+            if (candidates.size() > 1)
+            {
+               scores.assign(candidates.size(), 0);
+               for (size_t sample = 0; sample < settings.samples; sample++)
+               {
+                  KlondikePosition guess = truth;
+                  guess.Determinize(rng);
+                  uint64_t rollout_seed = rng();
+                  for (size_t i = 0; i < candidates.size(); i++)
+                  {
+                     KlondikePosition world = guess;
+                     Move move = candidates[i];
+                     world.Apply(move);
+                     Random::Xoshiro256 rollout_rng(rollout_seed);
+                     scores[i] += Rollout(world, scratch,
+                                          settings.rollout_moves,
+                                          rollout_rng);
+                  }
+               }
+               choice = std::max_element(scores.begin(), scores.end()) -
+                        scores.begin();
+            }
+
+            Move move = candidates[choice];
+            truth.Apply(move);
+            result.moves++;
+            scratch.clear();
+            AutoPlay(truth, scratch);
+            result.moves += scratch.size();
+            visited.insert(Hash(truth));
+         }
+
+         result.won = truth.Won();
+         result.home = truth.Home();
+         return result;
+      } // PlayRealistic
+
+      /// @brief Estimate how often a deal is won by a player who can't see
+      ///        the face down cards.
+      /// @param start The position to start from.
+      /// @param plays The amount of games to play.
+      /// @param seed The seed for the guesses and rollouts.
+      /// @param settings How hard to think about each move.
+      /// @return The fraction of games won, 0 to 1.
+      static double EstimateWinRate(
+         const KlondikePosition&          start,
+         const size_t                     plays,
+         const uint64_t                   seed,
+         const KlondikeRealisticSettings& settings =
+            KlondikeRealisticSettings())
+      {
+         size_t won = 0;
+         for (size_t i = 0; i < plays; i++)
+         {
+            Random::Xoshiro256 rng(Random::StreamSeed(seed, i));
+            won += PlayRealistic(start, rng, settings).won;
+         }
+         return plays ? double(won) / plays : 0;
+      }
+
+      /// @brief Check that a list of moves is legal and wins, seeing every
+      ///        card.
+      /// @param start The position to start from.
+      /// @param moves The moves.
+      /// @return True if every move is legal and the game ends won.
+      static bool Verify(const KlondikePosition& start,
+                         const std::vector<Move>& moves)
+      {
+         KlondikePosition check = start;
+         Move             legal[max_legal_moves];
+         for (Move move : moves)
+         {
+            // A move is legal if the generator would have made it. The
+            // generator only offers a single draw so any draw will do.
+            size_t count = check.GenerateMoves(legal);
+            bool found = false;
+            for (size_t i = 0; i < count; i++)
+            {
+               const Move& other = legal[i];
+               found = found ||
+                       (other.from == move.from &&
+                        other.from_index == move.from_index &&
+                        other.to == move.to &&
+                        other.to_index == move.to_index &&
+                        (other.amount == move.amount ||
+                         move.from == MovePlace::stock));
+            }
+            if (!found)
+            {
+               return false;
+            }
+            check.Apply(move);
+         }
+         return check.Won();
+      }
+      // ----------------------------------------------------------------------
+}; // KlondikeSolver
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Write the legal moves for a klondike position without allocating.
+///        Draws are one at a time since the stock can't be looked through.
+/// @param state The position.
+/// @param out Where the moves go. Must have room for "max_legal_moves".
+/// @return The amount of moves written.
+inline size_t GenerateLegalMoves(const KlondikePosition& state, Move* out)
+{
+   return state.GenerateMoves(out);
+}
+
+/// @brief Write the legal moves for a klondike game without allocating.
+/// @param state The game.
+/// @param out Where the moves go. Must have room for "max_legal_moves".
+/// @return The amount of moves written.
+inline size_t GenerateLegalMoves(const Klondike& state, Move* out)
+{
+   KlondikePosition position;
+   position.Load(state);
+   return position.GenerateMoves(out);
+}
+// ----------------------------------------------------------------------------
+} // Solitaire
+// ----------------------------------------------------------------------------
+
+#endif
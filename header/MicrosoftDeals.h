@@ -0,0 +1,88 @@
+#ifndef MICROSOFTDEALS_H
+#define MICROSOFTDEALS_H
+
+// ----------------------------------------------------------------------------
+// Include block.
+// ----------------------------------------------------------------------------
+
+// Standard library include.
+#include <cstddef>
+#include <cstdint>
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Namespace block.
+// ----------------------------------------------------------------------------
+
+/// @brief Numbered deals made the same way as the old Microsoft Freecell, so
+///        deal 1 here is deal 1 there.
+///
+///        The generator is the Microsoft C "rand": state = state * 214013 +
+///        2531011 and each number is bits 16 to 30 of the state. The deck
+///        starts with Microsoft's card numbers from 51 down to 0, where card
+///        "c" has rank c / 4 + 1 and suit "CDHS"[c % 4]. Each card from the
+///        top is swapped with one picked from the cards not yet placed.
+///
+///        Cards come out as card ids (suit index * 13 + rank - 1) in the
+///        order they are dealt. In Freecell card "i" goes on column i % 8.
+///        Every 32 bit number is a deal. Numbers past 2^31 just keep using
+///        the same generator. They are not the same as the extra deals some
+///        other programs added.
+namespace MicrosoftDeals
+{
+   // -------------------------------------------------------------------------
+   // Namespace Functions block.
+   // -------------------------------------------------------------------------
+
+   /// @brief Write the cards for one deal.
+   /// @param deal The deal number.
+   /// @param out Where the 52 card ids go, in the order they are dealt.
+   inline void Deal(const uint32_t deal, uint8_t* out)
+   {
+      // Microsoft's suits are clubs, diamonds, hearts, spades. Ours are
+      // spades, hearts, clubs, diamonds. This maps Microsoft's card number to
+      // our card id.
+      static constexpr uint8_t suit_index[4] = {2, 3, 1, 0};
+
+      uint8_t cards[52];
+      for (size_t i = 0; i < 52; i++)
+      {
+         cards[i] = static_cast<uint8_t>(51 - i);
+      }
+
+      uint32_t state = deal;
+      for (size_t i = 0; i < 52; i++)
+      {
+         state = state * 214013u + 2531011u;
+         size_t j = 51 - ((state >> 16) & 0x7fff) % (52 - i);
+         uint8_t temp = cards[i];
+         cards[i] = cards[j];
+         cards[j] = temp;
+      }
+
+      for (size_t i = 0; i < 52; i++)
+      {
+         out[i] = static_cast<uint8_t>(suit_index[cards[i] % 4] * 13 +
+                                       cards[i] / 4);
+      }
+   }
+
+   /// @brief Write the cards for a run of deals one after another. Deal
+   ///        "first + i" is at out[i * 52].
+   /// @param first The first deal number.
+   /// @param count The amount of deals.
+   /// @param out Where the count * 52 card ids go.
+   inline void DealRange(const uint32_t first,
+                         const size_t   count,
+                         uint8_t*       out)
+   {
+      for (size_t i = 0; i < count; i++)
+      {
+         Deal(static_cast<uint32_t>(first + i), out + i * 52);
+      }
+   }
+   // -------------------------------------------------------------------------
+} // MicrosoftDeals
+// ----------------------------------------------------------------------------
+
+#endif
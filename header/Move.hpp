@@ -0,0 +1,64 @@
+#ifndef MOVE_HPP
+#define MOVE_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <cstddef>
+#include <cstdint>
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Namespace block.
+// ----------------------------------------------------------------------------
+
+/// @brief Adding moves to the solitaire family of games.
+namespace Solitaire
+{
+// ----------------------------------------------------------------------------
+// Type Declarations block.
+// ----------------------------------------------------------------------------
+
+/// @brief Where cards in a move come from or go to. Freecell uses columns,
+///        cells and foundations. Klondike uses columns, the waste, the stock
+///        and foundations.
+enum class MovePlace : uint8_t
+{
+   column,
+   cell,
+   foundation,
+   waste,
+   stock
+};
+
+/// @brief One move in any solitaire game, small enough to make millions of.
+///        Indices are 0 based. For the foundation the index is the suit
+///        index. Freecell cells are kept packed to the front like the game
+///        keeps them, so a cell index is the game's free index minus one.
+///        A klondike draw is a move from the stock to the waste and "amount"
+///        is how many draws are made in a row.
+struct Move
+{
+   MovePlace from         = MovePlace::column;
+   uint8_t   from_index   = 0;
+   MovePlace to           = MovePlace::column;
+   uint8_t   to_index     = 0;
+   // The amount of cards moved, or of draws made.
+   uint8_t   amount       = 1;
+   // Filled in by klondike when the move is made so it can be taken back.
+   // Whether a face down card was turned up, and how many cards were in the
+   // waste.
+   bool      flipped      = false;
+   uint8_t   waste_before = 0;
+};
+
+// The most moves any freecell or klondike position can have. A buffer given
+// to "GenerateLegalMoves" must have room for this many.
+constexpr size_t max_legal_moves = 256;
+// ----------------------------------------------------------------------------
+} // Solitaire
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef PACKEDPOLARSTANDARDPLAYINGCARD_HPP
+#define PACKEDPOLARSTANDARDPLAYINGCARD_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Regular File includes.
+// This is the header file for the packed standard playing card class.
+#include "PackedStandardPlayingCard.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief This is the packed version of "PolarStandardPlayingCard". The
+///        face-up flag is stored in the same byte as the rank and suit.
+class PackedPolarStandardPlayingCard: public PackedStandardPlayingCard
+{
+   public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      /// @brief The default constructor makes the "no card" value.
+      PackedPolarStandardPlayingCard() = default;
+
+      /// @brief This is the constructor that should be used.
+      /// @param rank_input The rank of the card to be constructed.
+      /// @param suit_input The suit of the card to be constructed.
+      /// @param face_up_input If the card is to be constructed face up or
+      ///                      face down. Face down by default.
+      PackedPolarStandardPlayingCard(const int          rank_input,
+                                     const std::string& suit_input,
+                                     const bool         face_up_input = false):
+         PackedStandardPlayingCard(rank_input, suit_input)
+      {
+         if (face_up_input)
+         {
+            bits |= face_up_mask;
+         }
+      }
+
+      /// @brief The constructor for when we already know the suit index.
+      /// @param rank_input The rank of the card to be constructed.
+      /// @param suit_index The index of the suit in
+      ///                   "CardGraphicsAndInfo::suits".
+      /// @param face_up_input If the card is to be constructed face up or
+      ///                      face down. Face down by default.
+      PackedPolarStandardPlayingCard(const int    rank_input,
+                                     const size_t suit_index,
+                                     const bool   face_up_input = false):
+         PackedStandardPlayingCard(rank_input, suit_index)
+      {
+         if (face_up_input)
+         {
+            bits |= face_up_mask;
+         }
+      }
+
+      /// @brief Make a face-down card from its id.
+      /// @param id The id of the card 0 through 51.
+      /// @return The card.
+      static PackedPolarStandardPlayingCard FromId(const size_t id)
+      {
+         return PackedPolarStandardPlayingCard(static_cast<int>(id % 13) + 1,
+                                               id / 13);
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Operator Overloads block.
+      // ----------------------------------------------------------------------
+
+      /// @brief This is an oveload for the equals operator.
+      /// @param obj The object we are trying to see if it is the same as ours.
+      /// @return Returns whether the values are equal or not.
+      bool operator==(const PackedPolarStandardPlayingCard &obj) const
+      {
+         return bits == obj.bits;
+      }
+
+      /// @brief Same as the base class but keeps the polar type so
+      ///        "pile.back()->FlipCard()" works.
+      /// @return A pointer to this card.
+      PackedPolarStandardPlayingCard* operator->() { return this; }
+      const PackedPolarStandardPlayingCard* operator->() const { return this; }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Get Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Standard get function for the face-up flag.
+      /// @return Returns whether the card is face up.
+      bool GetFaceUp() const { return (bits & face_up_mask) != 0; }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief This function will flip a card face up or flip it face down;
+      ///        Whatever the card is not this function will flip it the other
+      ///        way.
+      void FlipCard() { bits ^= face_up_mask; }
+      // ----------------------------------------------------------------------
+}; // PackedPolarStandardPlayingCard
+// ----------------------------------------------------------------------------
+
+#endif
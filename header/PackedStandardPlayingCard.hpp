@@ -0,0 +1,226 @@
+#ifndef PACKEDSTANDARDPLAYINGCARD_HPP
+#define PACKEDSTANDARDPLAYINGCARD_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// File includes.
+// This adds the static const variables used for the cards.
+#include "StandardPlayingCardStaticVariables.h"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief This class is a standard playing card packed into a single byte.
+///        Unlike "StandardPlayingCard" it holds no graphic, strings or
+///        pointers so it is trivially copyable and lives by value inside a
+///        pile. The graphic is only looked up from "CardGraphicsAndInfo"
+///        when the card is drawn to the screen.
+///
+///        The byte is laid out as follows.
+///        Bits 0-3: The rank 1 through 13. A rank of 0 means "no card".
+///        Bits 4-5: The index of the suit in "CardGraphicsAndInfo::suits".
+///        Bit  6:   The face-up flag. Only used by the polar variant.
+class PackedStandardPlayingCard
+{
+   protected:
+      // ----------------------------------------------------------------------
+      // Protected Variables block.
+      // ----------------------------------------------------------------------
+
+      // The masks and shifts for the fields in the byte.
+      static constexpr uint8_t rank_mask    = 0x0f;
+      static constexpr uint8_t suit_mask    = 0x30;
+      static constexpr uint8_t suit_shift   = 4;
+      static constexpr uint8_t face_up_mask = 0x40;
+
+      // The actual card. See the class description for the layout.
+      uint8_t bits = 0;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Protected Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Pack the rank and suit index into the byte. If either is out
+      ///        of range the card is left as "no card".
+      /// @param rank_input The rank 1 through 13.
+      /// @param suit_index The index of the suit in
+      ///                   "CardGraphicsAndInfo::suits".
+      void Pack(const int rank_input, const size_t suit_index)
+      {
+         if (rank_input < 1 || rank_input > 13 || suit_index > 3)
+         {
+            std::cerr << "Error: Invalid rank or suit input." << std::endl;
+            bits = 0;
+            return;
+         }
+
+         bits = static_cast<uint8_t>(rank_input) |
+                static_cast<uint8_t>(suit_index << suit_shift);
+      }
+
+      /// @brief Find the index of the suit name.
+      /// @param suit_input The name of the suit. ("spade", "heart" ...)
+      /// @return The index of the suit or 4 if it was not found.
+      static size_t FindSuitIndex(const std::string& suit_input)
+      {
+         for (size_t i = 0; i < CardGraphicsAndInfo::suits.size(); i++)
+         {
+            if (suit_input == CardGraphicsAndInfo::suits[i])
+            {
+               return i;
+            }
+         }
+
+         return 4;
+      }
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      /// @brief The default constructor makes the "no card" value. This is
+      ///        what an empty slot or an empty draw returns.
+      PackedStandardPlayingCard() = default;
+
+      /// @brief This is the standard constructor. Same as the one for
+      ///        "StandardPlayingCard" so the two can be swapped.
+      /// @param rank_input The rank of the card we want to make.
+      /// @param suit_input The suit of the card we want to make.
+      PackedStandardPlayingCard(const int rank_input,
+                                const std::string& suit_input)
+      {
+         Pack(rank_input, FindSuitIndex(suit_input));
+      }
+
+      /// @brief The constructor for when we already know the suit index.
+      ///        This skips the string lookup.
+      /// @param rank_input The rank of the card we want to make.
+      /// @param suit_index The index of the suit in
+      ///                   "CardGraphicsAndInfo::suits".
+      PackedStandardPlayingCard(const int rank_input,
+                                const size_t suit_index)
+      {
+         Pack(rank_input, suit_index);
+      }
+
+      /// @brief Make a card from its id. See "GetId".
+      /// @param id The id of the card 0 through 51.
+      /// @return The card.
+      static PackedStandardPlayingCard FromId(const size_t id)
+      {
+         return PackedStandardPlayingCard(static_cast<int>(id % 13) + 1,
+                                          id / 13);
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Operator overloads block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Overloaded equals operator to see if two cards are the same.
+      ///        The face-up flag is not part of the card itself.
+      /// @param obj The object we want to test.
+      /// @return Whether they are equal or not. True if they are. False
+      ///         otherwise.
+      bool operator==(const PackedStandardPlayingCard &obj) const
+      {
+         return (bits & ~face_up_mask) == (obj.bits & ~face_up_mask);
+      }
+
+      /// @brief Whether this is an actual card and not the "no card" value.
+      explicit operator bool() const { return (bits & rank_mask) != 0; }
+
+      /// @brief Piles hold these cards by value where they used to hold a
+      ///        pointer to the card. This lets the games keep using
+      ///        "pile.back()->GetRank()" for either kind of pile.
+      /// @return A pointer to this card.
+      PackedStandardPlayingCard* operator->() { return this; }
+      const PackedStandardPlayingCard* operator->() const { return this; }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Get block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Get the graphic for displaying the card. This is a reference
+      ///        to the shared table so nothing is copied.
+      /// @return Returns the rows of the graphic.
+      const CardGraphicsAndInfo::CardArt& GetGraphic() const
+      {
+         static constexpr CardGraphicsAndInfo::CardArt unknown = {"Unknown"};
+
+         if (!*this)
+         {
+            return unknown;
+         }
+
+         return CardGraphicsAndInfo::graphics[GetSuitIndex()][GetRank() - 1];
+      }
+
+      /// @brief Get the rank of the card.
+      /// @return Return the rank.
+      int GetRank() const { return bits & rank_mask; }
+
+      /// @brief Get the index of the suit in "CardGraphicsAndInfo::suits".
+      /// @return Return the suit index.
+      size_t GetSuitIndex() const { return (bits & suit_mask) >> suit_shift; }
+
+      /// @brief Get the suit of the card.
+      /// @return Return the suit.
+      std::string_view GetSuit() const
+      {
+         return CardGraphicsAndInfo::suits[GetSuitIndex()];
+      }
+
+      /// @brief Get the color of the suit.
+      /// @return Returns the color of the suit.
+      std::string_view GetColor() const
+      {
+         constexpr std::string_view red   = "red";
+         constexpr std::string_view black = "black";
+
+         if (GetColorType() == CardGraphicsAndInfo::Color::red)
+         {
+            return red;
+         }
+
+         return black;
+      }
+
+      /// @brief Get the suit of the card as a value. This is what the games
+      ///        compare when checking moves.
+      /// @return Return the suit.
+      CardGraphicsAndInfo::Suit GetSuitType() const
+      {
+         return static_cast<CardGraphicsAndInfo::Suit>(GetSuitIndex());
+      }
+
+      /// @brief Get the color of the suit as a value.
+      /// @return Returns the color of the suit.
+      CardGraphicsAndInfo::Color GetColorType() const
+      {
+         return CardGraphicsAndInfo::GetSuitColor(GetSuitType());
+      }
+
+      /// @brief Get the id of the card. Every card has a unique id from 0 to
+      ///        51 which is the suit index times 13 plus the rank minus one.
+      /// @return Return the id.
+      size_t GetId() const { return GetSuitIndex() * 13 + GetRank() - 1; }
+      // ----------------------------------------------------------------------
+}; // PackedStandardPlayingCard
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,182 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+// ----------------------------------------------------------------------------
+// Include block.
+// ----------------------------------------------------------------------------
+
+// Standard library include.
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Namespace block.
+// ----------------------------------------------------------------------------
+
+/// @brief Small random number helpers used by the simulations.
+namespace Random
+{
+   // -------------------------------------------------------------------------
+   // Namespace Functions block.
+   // -------------------------------------------------------------------------
+
+   /// @brief The SplitMix64 finalizer. Turns any 64 bit value into a well
+   ///        mixed 64 bit value. Nearby inputs give unrelated outputs.
+   /// @param x The value to mix.
+   /// @return The mixed value.
+   inline uint64_t SplitMix64(uint64_t x)
+   {
+      x += 0x9e3779b97f4a7c15ULL;
+      x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+      x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+      return x ^ (x >> 31);
+   }
+
+   /// @brief Get the seed for one item of a batch. This is counter based so
+   ///        item "index" always gets the same seed no matter which thread
+   ///        or in what order it is run.
+   /// @param master_seed The seed for the whole batch.
+   /// @param index The index of the item in the batch.
+   /// @return The seed for that item.
+   inline uint64_t StreamSeed(const uint64_t master_seed,
+                              const uint64_t index)
+   {
+      return SplitMix64(SplitMix64(master_seed) ^ index);
+   }
+
+   /// @brief Get a new seed that no other call in this thread will get. The
+   ///        first call in each thread reads "std::random_device" once, and
+   ///        after that this is just a counter and a mix.
+   /// @return The seed.
+   inline uint64_t FreshSeed()
+   {
+      thread_local uint64_t counter =
+         (uint64_t(std::random_device()()) << 32) ^ std::random_device()();
+      return SplitMix64(counter++);
+   }
+
+   /// @brief Get a number below "range" with every number equally likely.
+   ///        This is Lemire's multiply and shift. It only divides in the
+   ///        rare case the first try lands in the biased part.
+   /// @tparam Generator A generator giving 32 or 64 random bits per call.
+   /// @param rng The generator.
+   /// @param range How many numbers there are to pick from. Not 0.
+   /// @return A number from 0 to range - 1.
+   template<typename Generator>
+   inline uint32_t Below(Generator& rng, const uint32_t range)
+   {
+      constexpr uint64_t most = Generator::max();
+      static_assert(Generator::min() == 0 &&
+                    (most == 0xffffffffULL || most == ~uint64_t(0)),
+                    "Below needs a generator giving 32 or 64 random bits.");
+
+      // The high bits of 64 bit generators are the best ones.
+      auto next = [&rng]() -> uint64_t
+      {
+         return most == 0xffffffffULL ? uint64_t(rng())
+                                      : uint64_t(rng()) >> 32;
+      };
+
+      uint64_t product = next() * range;
+      uint32_t low     = static_cast<uint32_t>(product);
+      if (low < range)
+      {
+         const uint32_t threshold = -range % range;
+         while (low < threshold)
+         {
+            product = next() * range;
+            low     = static_cast<uint32_t>(product);
+         }
+      }
+      return static_cast<uint32_t>(product >> 32);
+   }
+
+   /// @brief Put a range in a random order with every order equally likely.
+   ///        This is the Fisher-Yates shuffle using "Below".
+   /// @tparam Iterator A random access iterator.
+   /// @tparam Generator A generator "Below" can use.
+   /// @param first The start of the range.
+   /// @param last The end of the range.
+   /// @param rng The generator.
+   template<typename Iterator, typename Generator>
+   inline void Shuffle(Iterator first, Iterator last, Generator& rng)
+   {
+      using std::swap;
+      for (auto i = static_cast<uint32_t>(last - first); i > 1; i--)
+      {
+         swap(first[i - 1], first[Below(rng, i)]);
+      }
+   }
+   // -------------------------------------------------------------------------
+
+   // -------------------------------------------------------------------------
+   // Class block.
+   // -------------------------------------------------------------------------
+
+   /// @brief The xoshiro256** generator. It is small (32 bytes), fast and
+   ///        passes the usual statistical tests, which is all a shuffle
+   ///        needs. It works anywhere a standard uniform random bit
+   ///        generator does.
+   class Xoshiro256
+   {
+      private:
+         // The state. It is never all zero.
+         uint64_t state[4];
+
+         /// @brief Rotate the bits left.
+         static uint64_t Rotate(const uint64_t x, const int k)
+         {
+            return (x << k) | (x >> (64 - k));
+         }
+
+      public:
+         using result_type = uint64_t;
+
+         /// @brief Make a generator from a seed. The seed is spread over the
+         ///        state with SplitMix64 so any seed is fine.
+         /// @param seed The seed.
+         explicit Xoshiro256(const uint64_t seed = 0) { Seed(seed); }
+
+         /// @brief Start over from a seed.
+         /// @param seed The seed.
+         void Seed(uint64_t seed)
+         {
+            for (uint64_t& word : state)
+            {
+               word = SplitMix64(seed);
+               seed += 0x9e3779b97f4a7c15ULL;
+            }
+         }
+
+         /// @brief The smallest number this can give.
+         static constexpr result_type min() { return 0; }
+
+         /// @brief The biggest number this can give.
+         static constexpr result_type max()
+         {
+            return std::numeric_limits<result_type>::max();
+         }
+
+         /// @brief Get the next 64 random bits.
+         /// @return The bits.
+         result_type operator()()
+         {
+            const uint64_t out  = Rotate(state[1] * 5, 7) * 9;
+            const uint64_t t    = state[1] << 17;
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3]  = Rotate(state[3], 45);
+            return out;
+         }
+   }; // Xoshiro256
+   // -------------------------------------------------------------------------
+} // Random
+// ----------------------------------------------------------------------------
+
+#endif
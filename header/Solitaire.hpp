@@ -5,13 +5,23 @@
 // Includes block.
 // ----------------------------------------------------------------------------
 
+// Standard Library includes.
+#include <iterator>
+#include <string_view>
+
 // Some ANSI utility functions like clear the screen and go to the corner.
 #include "Ansi.h"
+// The screen is built in one buffer and only the changes are written.
+#include "DiffRenderer.hpp"
+// Timers for the hot parts when built with "TRACING".
+#include "Trace.h"
 
 // Regular File includes.
 // This is the header file for the implementation of a standard deck
 // of cards class.
 #include "StandardDeck.hpp"
+// The moves shared by every solitaire game.
+#include "Move.hpp"
 // ----------------------------------------------------------------------------
 
 // ----------------------------------------------------------------------------
@@ -21,6 +31,10 @@
 /// @brief This is the base or start of the Solitaire namespace.
 namespace Solitaire
 {
+// The suits and colors of the cards are compared as values.
+using CardGraphicsAndInfo::Color;
+using CardGraphicsAndInfo::Suit;
+
 // ----------------------------------------------------------------------------
 // Class block.
 // ----------------------------------------------------------------------------
@@ -44,9 +58,13 @@ class Solitaire
       // The free or drawn cards.
       mutable Pile<T>              free;
       // The board, where the games are played.
-      mutable std::vector<Pile<T>> board;
+      mutable InlinePile<Pile<T>, 8> board;
       // The place where the cards are stacked by suit.
-      mutable std::vector<Pile<T>> stacks;
+      mutable InlinePile<Pile<T>, 4> stacks;
+      // Every move made since the deal, so they can be taken back.
+      std::vector<Move>            history;
+      // Draws the screen. It keeps the last screen to only send changes.
+      DiffRenderer                 screen;
       // ----------------------------------------------------------------------
 
       // ----------------------------------------------------------------------
@@ -67,45 +85,37 @@ class Solitaire
             return true; 
          }
 
-         // Get the size of the pile.
-         size_t board_pile_size = board[pile_from - 1].size();
-         // Get the last card in the amounts rank.
-         size_t prev_rank = board[pile_from - 1][board_pile_size - amount]
-                               ->GetRank();
-         // Get the last cards color.
-         std::string prev_color 
-            = board[pile_from - 1][board_pile_size - amount]
-            ->GetColor();
+         // The cards being checked start this far into the pile.
+         const Pile<T>& pile  = board[pile_from - 1];
+         const size_t   start = pile.size() - amount;
          // Now for the amount go through each card.
-         for (size_t i = 1; i < amount; i++)
+         for (size_t i = start + 1; i < start + amount; i++)
          {
-            // Get the current rank and color.
-            size_t curn_rank = 
-               board[pile_from - 1][board_pile_size - amount + i]->GetRank();
-            std::string curnColor = 
-               board[pile_from - 1][board_pile_size - amount + i]->GetColor();
-            
-            // Then if the previous and current colors match or the ranks are
-            // not descending then return false.
-            if (curnColor == prev_color ||
-                !(prev_rank == curn_rank + 1))
+            // If the previous and current colors match or the ranks are not
+            // descending then return false.
+            if (pile[i]->GetColorType() == pile[i - 1]->GetColorType() ||
+                pile[i - 1]->GetRank() != pile[i]->GetRank() + 1)
             {
                return false;
             }
-
-            // Make the current rank and color the previous ones. 
-            prev_rank = board[pile_from - 1][board_pile_size - amount + i]
-                           ->GetRank();
-            prev_color = board[pile_from - 1][board_pile_size - amount + i]
-                           ->GetColor();
          }
 
          // If we go through all that return true.
          return true;
       } // CheckDescendingPile
 
+      /// @brief This function will give the index of the stack for a suit.
+      ///        The stacks are in the same order as the suits.
+      /// @param stack The suit.
+      /// @return The index of the stack which matches the suit.
+      static size_t GetStackSuit(const Suit stack)
+      {
+         return static_cast<size_t>(stack);
+      }
+
       /// @brief This function will give the index of the stack as
-      ///        defined by the variable "stack".
+      ///        defined by the variable "stack". This is only for reading
+      ///        what the player typed.
       /// @param stack The suit name.
       /// @return The index of the stack which matches the entered suit.
       size_t GetStackSuit(const std::string stack)
@@ -135,6 +145,60 @@ class Solitaire
          return -1;
       }
 
+      /// @brief Get the pile for a place in a move. Cells and the waste are
+      ///        both the free pile. The stock is not a pile.
+      /// @param place The place.
+      /// @param index The column or suit index.
+      /// @return The pile.
+      Pile<T>& GetMovePile(const MovePlace place, const size_t index)
+      {
+         if (place == MovePlace::column)
+         {
+            return board[index];
+         }
+         else if (place == MovePlace::foundation)
+         {
+            return stacks[index];
+         }
+         return free;
+      }
+
+      /// @brief Move cards from the top of one pile to the top of another
+      ///        keeping their order.
+      /// @param from The pile to take them from.
+      /// @param to The pile to put them on.
+      /// @param amount The amount of cards.
+      static void MoveCards(Pile<T>& from, Pile<T>& to, const size_t amount)
+      {
+         to.insert(to.end(),
+                   std::make_move_iterator(from.end() - amount),
+                   std::make_move_iterator(from.end()));
+         from.erase(from.end() - amount, from.end());
+      }
+
+      /// @brief Make a move and remember it so it can be undone. All the
+      ///        player's moves and the automatic ones go through here.
+      /// @param move The move. It must be legal.
+      void MakeMove(Move move)
+      {
+         ALLOCATION_SCOPE(move);
+         ApplyMove(move);
+         history.push_back(move);
+      }
+
+      /// @brief Take back the last move made.
+      /// @return Whether there was a move to take back.
+      bool UndoLastMove()
+      {
+         if (history.empty())
+         {
+            return false;
+         }
+         UndoMove(history.back());
+         history.pop_back();
+         return true;
+      }
+
       /// @brief An entirely virtual class this will need to be defined in
       ///        child classes. This function should deal all the cards.
       virtual void Deal() {}
@@ -164,7 +228,7 @@ class Solitaire
                size_t size = board[i].size();
                // Check the bottom card.
                MoveBoardToStack(i + 1, 
-                                board[i].back()->GetSuit(),
+                                board[i].back()->GetSuitType(),
                                 true);
                // Set the "out" variable.
                out = board[i].size() != size || out;
@@ -178,8 +242,9 @@ class Solitaire
       ///        previous functions until no cards were moved by either.
       virtual void AutoMove()
       {
+         ALLOCATION_SCOPE(auto_move);
+         TRACE_SCOPE("Solitaire::AutoMove");
          do { } while (AutoMoveFree() || AutoMoveBoard());
-         
       }
 
       /// @brief This function will move cards from a board slot
@@ -200,9 +265,9 @@ class Solitaire
       /// @param pile_from The board index the cards will be moved from.
       /// @param stack The stack suit to move the card to.
       /// @param aut Whether this is called by the automove function.
-      virtual void MoveBoardToStack(const size_t      pile_from,
-                                    const std::string stack,
-                                    bool              aut)
+      virtual void MoveBoardToStack(const size_t pile_from,
+                                    const Suit   stack,
+                                    bool         aut)
       {}
 
       /// @brief This function will move cards from a free slot
@@ -216,8 +281,8 @@ class Solitaire
       ///        child classes.
       /// @param stack The stack suit to move the card to.
       /// @param aut Whether this is called by the automove function.
-      virtual void MoveFreeToStack(const std::string stack,
-                                   bool              aut) 
+      virtual void MoveFreeToStack(const Suit stack,
+                                   bool       aut) 
       {}
 
       /// @brief This function will move cards from stack slot
@@ -225,8 +290,8 @@ class Solitaire
       ///        child classes.
       /// @param pile_to The board index to move the card to.
       /// @param stack The stack suit to move the card to.
-      virtual void MoveStackToBoard(const size_t      pile_to, 
-                                    const std::string stack)
+      virtual void MoveStackToBoard(const size_t pile_to, 
+                                    const Suit   stack)
       {}
 
       /// @brief This function will get the users input and put them in
@@ -284,11 +349,11 @@ class Solitaire
          return false;
       } // GetInputAndExecuteAction
 
-      /// @brief This function gets the top row graphic. 
+      /// @brief This function adds the top row graphic to the frame. 
       ///        This function is entirely virtual so it should be defined
       ///        on the child class.
-      /// @return Returns the string vector of the top row graphic.
-      virtual std::vector<std::string> TopRowGraphic() { return {}; }
+      /// @param frame The frame to add the rows to.
+      virtual void TopRowGraphic(FrameBuffer& /*frame*/) {}
 
       /// @brief This function tracks if the game has been won.
       /// @return Returns whether the game is won. True if won. False
@@ -310,47 +375,47 @@ class Solitaire
          return true;
       } // WinCondition
 
-      /// @brief This function will add the stack graphics to the string
-      ///        vector.
-      /// @param original The original string vector with the graphics. 
-      /// @param stack The stack suit.
-      void AddStackGraphics(std::vector<std::string>& original,
-                            size_t                    stack)
+      /// @brief This function will add one row of the stack graphics to
+      ///        the frame.
+      /// @param frame The frame with the graphics. 
+      /// @param row The row of the card graphics.
+      void AddStackGraphics(FrameBuffer& frame,
+                            const size_t row) const
       {
-         // Go through each row.
-         for (size_t i = 0; i < original.size(); i++)
+         // Go through each stack.
+         for (size_t stack = 0; stack < stacks.size(); stack++)
          {
             // If the stack is empty then put the empty graphic.
             if (stacks[stack].empty())
             {
-               original[i].append(CardGraphicsAndInfo::empty[i]);
+               frame.Append(CardGraphicsAndInfo::empty[row]);
             }
             else
             {
                // Else just add the cards graphics.
-               original[i].append(stacks[stack].back()->GetGraphic().at(i));
+               frame.Append(stacks[stack].back()->GetGraphic()[row]);
             }
 
             // Make sure to add a space.
             if (stack != stacks.size() - 1)
             {
-               original[i].append("  ");
+               frame.Append("  ");
             }
          }
       } // AddStackGraphics
 
       
       /// @brief Get the string for graphics from the board at the row 
-      ///        in the slot specified. 
+      ///        in the slot specified. It looks into the shared card art so
+      ///        nothing is copied.
       ///        If something is out of range it should return "".
       /// @param row The row of the pile to get the graphic from.
       /// @param pile The pile to get the graphic from.
       /// @return Return the string for that row.
-      std::string GetBoardRowPile(const size_t row,
-                                  const size_t pile)
+      std::string_view GetBoardRowPile(const size_t row,
+                                       const size_t pile) const
       {
-         // Initialize the "out" variable where we will put the string.
-         std::string out;
+         TRACE_SCOPE("Solitaire::GetBoardRowPile");
 
          // The amount of cards in the pile.
          size_t cards = board[pile].size();
@@ -364,42 +429,15 @@ class Solitaire
             {
                return CardGraphicsAndInfo::back[0];
             }
-            else if (row % 3 == 1)
-            {
-               if constexpr(std::is_same_v<T, PolarStandardPlayingCard>)
-               {
-                  if (!board[pile][row / 3]->GetFaceUp())
-                  {
-                     return CardGraphicsAndInfo::back[1];
-                  }
-                  else 
-                  {
-                     return board[pile][row / 3]->GetGraphic().at(1);
-                  }
-               }
-               else 
-               {
-                  return board[pile][row / 3]->GetGraphic().at(1);
-               }
-            }
-            else if (row % 3 == 2)
+
+            if constexpr(IsPolarCard<T>::value)
             {
-               if constexpr(std::is_same_v<T, PolarStandardPlayingCard>)
+               if (!board[pile][row / 3]->GetFaceUp())
                {
-                  if (!board[pile][row / 3]->GetFaceUp())
-                  {
-                     return CardGraphicsAndInfo::back[2];
-                  }
-                  else 
-                  {
-                     return board[pile][row / 3]->GetGraphic().at(2);
-                  }
-               }
-               else 
-               {
-                  return board[pile][row / 3]->GetGraphic().at(2);
+                  return CardGraphicsAndInfo::back[row % 3];
                }
             }
+            return board[pile][row / 3]->GetGraphic()[row % 3];
          }
          else if ((row >= (3 * (cards - 1))) &&
                   (row < ((3 * (cards - 1)) + 9)) &&
@@ -407,50 +445,17 @@ class Solitaire
          {
             // Otherwise we just get the card graphic.
             size_t index = row - (3 * (board[pile].size() - 1));
-            return board[pile].back()->GetGraphic().at(index);
+            return board[pile].back()->GetGraphic()[index];
          }
 
          // If we failed miserably return nothing.
-         return "";
+         return {};
       } // GetBoardRowPile
 
-      /// @brief This function will display the screen given to it.
-      /// @param screen The vector of strings which is the string.
-      void DisplayScreen(const std::vector<std::string> screen)
-      {
-         // Clear the screen.
-         std::cout << Ansi_t::clrscr();
-         // Go to the corner.
-         std::cout << Ansi_t::gotoRC(0,0);
-
-         // Go through each row and and display the screen string.
-         for (size_t i = 0; i < screen.size(); i++)
-         {
-            std::cout << screen[i] << "\n";
-         }
-      }
-
-      /// @brief This function prints the screen.
-      void PrintScreen()
+      /// @brief Build the whole screen as the next frame of "screen"
+      ///        without sending it.
+      void BuildScreen()
       {
-         // The screen to be printed.
-         std::vector<std::string> screen = TopRowGraphic();
-
-         // DEBUG
-         //DisplayScreen(screen);
-
-         // Make labels for the different board piles.
-         std::string labels("");
-         for (size_t i = 0; i < board.size(); i++)
-         {
-            labels.append("      " + std::to_string(i + 1) + "      ");
-            if (i != board.size() - 1)
-            {
-               labels.append("  ");
-            }
-         }
-         screen.push_back(labels);
-         
          // Create the lines for the board graphics.
          // First get the max cards in the stacks.
          size_t max_cards = 0;
@@ -464,51 +469,115 @@ class Solitaire
 
          // How many lines we will need to output.
          size_t lines = (3 * max_cards) + 9;
+
+         // Every row is at most a card graphic and a gap per pile. The suit
+         // symbols take three bytes so leave room for them.
+         FrameBuffer& frame = 
+            screen.Begin(CardGraphicsAndInfo::graphic_rows + 1 + lines,
+                         board.size() * 24);
+
+         // The top row is particular to the game.
+         TopRowGraphic(frame);
+
+         // Make labels for the different board piles.
+         for (size_t i = 0; i < board.size(); i++)
+         {
+            frame.Append(6, ' ');
+            frame.AppendNumber(i + 1);
+            frame.Append(6, ' ');
+            if (i != board.size() - 1)
+            {
+               frame.Append("  ");
+            }
+         }
+         frame.EndRow();
+
          // Get the graphics for the board.
          for (size_t i = 0; i < lines; i++)
          {
-            std::string temp1;
-
             for (size_t j = 0; j < board.size(); j++)
             {
-               std::string temp2 = GetBoardRowPile(i, j);
+               std::string_view temp = GetBoardRowPile(i, j);
 
                if ((board[j].empty() && i < 9) &&
-                  (temp2 == ""))
+                  (temp.empty()))
                {
-                  temp1.append(CardGraphicsAndInfo::empty[i]);
+                  frame.Append(CardGraphicsAndInfo::empty[i]);
                }
                else if ((board[j].empty() && i >= 9) ||
-                        (temp2 == ""))
+                        (temp.empty()))
                {
-                  temp1.append("             ");
+                  frame.Append("             ");
                }
                else
                {
-                  temp1.append(temp2);
+                  frame.Append(temp);
                }
 
                if (j < board.size() - 1)
                {
-                  temp1.append("  ");
+                  frame.Append("  ");
                }
             }
 
-            screen.push_back(temp1);
-            
-            // DEBUG
-            //DisplayScreen(screen);
+            frame.EndRow();
          }
+      } // BuildScreen
 
-         DisplayScreen(screen);
+      /// @brief This function prints the screen. The whole screen is built
+      ///        in one frame and only what changed since the last one is
+      ///        written out.
+      void PrintScreen()
+      {
+         ALLOCATION_SCOPE(frame);
+         TRACE_SCOPE("Solitaire::PrintScreen");
+         BuildScreen();
+         screen.Present();
+         TRACE_COUNTER("frame bytes", screen.GetLastOutput().size());
       } // PrintScreen
       // ----------------------------------------------------------------------
 
    public:
+      // ----------------------------------------------------------------------
+      // Get block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Get the deck. What is left in it after dealing is the stock.
+      /// @return Return the reference to the deck.
+      const StandardDeck<T>& GetDeck() const { return deck; }
+
+      /// @brief Get the board piles.
+      /// @return Return the reference to the board.
+      const InlinePile<Pile<T>, 8>& GetBoard() const { return board; }
+
+      /// @brief Get the free or drawn cards.
+      /// @return Return the reference to the free cards.
+      const Pile<T>& GetFree() const { return free; }
+
+      /// @brief Get the stacks. They are indexed by suit index.
+      /// @return Return the reference to the stacks.
+      const InlinePile<Pile<T>, 4>& GetStacks() const { return stacks; }
+
+      /// @brief Get the moves made since the deal, oldest first.
+      /// @return Return the reference to the moves.
+      const std::vector<Move>& GetHistory() const { return history; }
+      // ----------------------------------------------------------------------
+
       // ----------------------------------------------------------------------
       // Public Function block.
       // ----------------------------------------------------------------------
       
+      /// @brief Make a move straight on the piles without any checks or
+      ///        strings. This should be defined on child classes.
+      /// @param move The move. It must be legal. Anything needed to take it
+      ///             back is filled in.
+      virtual void ApplyMove(Move& /*move*/) {}
+
+      /// @brief Take back a move that was just made. This should be defined
+      ///        on child classes.
+      /// @param move The move as it was filled in by "ApplyMove".
+      virtual void UndoMove(const Move& /*move*/) {}
+
       /// @brief This function actually plays the game. This is an entirely
       ///        virtual function and should be defined by it's child classes.
       virtual void PlayGame() {};
@@ -7,30 +7,144 @@
 
 // Standard Library includes.
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <memory>
-#include <random>
+#include <type_traits>
 #include <vector>
 
 // File includes.
 // Includes the actual cards.
 #include "StandardPlayingCard.hpp"
 #include "PolarStandardPlayingCard.hpp"
+#include "PackedStandardPlayingCard.hpp"
+#include "PackedPolarStandardPlayingCard.hpp"
+// Piles keep their cards inside themselves.
+#include "InlinePile.hpp"
+// The generator and shuffle.
+#include "Random.h"
+// Deals as numbers.
+#include "DealRank.h"
+// Counts allocations in shuffles when built with "ALLOCATION_STATS".
+#include "AllocationStats.h"
 // ----------------------------------------------------------------------------
 
 // ----------------------------------------------------------------------------
 // Type Declarations block.
 // ----------------------------------------------------------------------------
 
-/// @brief A "pile" of cards.
-/// @tparam T This should be either PolarStandardPlayingCard or
-///           StandardPlayingCard. May expand later.
+/// @brief This describes how a card is held inside a pile. Standard and
+///        polar cards are big so they live on the heap and the pile holds
+///        pointers to them.
+/// @tparam T The type of card.
 template<typename T>
-using Pile = std::vector<std::unique_ptr<T>>;
+struct CardStorage
+{
+   // What the pile actually holds.
+   using Slot = std::unique_ptr<T>;
+
+   /// @brief Make a new card for a pile.
+   /// @param rank The rank of the card.
+   /// @param suit_index The index of the suit in "CardGraphicsAndInfo::suits".
+   /// @return The new card.
+   static Slot Make(const int rank, const size_t suit_index)
+   {
+      return std::make_unique<T>(
+         rank, std::string(CardGraphicsAndInfo::suits[suit_index]));
+   }
+
+   /// @brief Copy a card from a pile. This makes a new card.
+   /// @param slot The card we want to copy.
+   /// @return The copied card.
+   static Slot Copy(const Slot& slot)
+   {
+      if (slot)
+      {
+         return std::make_unique<T>(*slot);
+      }
+      return nullptr;
+   }
+};
+
+/// @brief Packed cards are a single byte so the pile holds them by value.
+/// @tparam T Either PackedStandardPlayingCard or
+///           PackedPolarStandardPlayingCard.
+template<typename T>
+struct PackedCardStorage
+{
+   // What the pile actually holds.
+   using Slot = T;
+
+   /// @brief Make a new card for a pile.
+   /// @param rank The rank of the card.
+   /// @param suit_index The index of the suit in "CardGraphicsAndInfo::suits".
+   /// @return The new card.
+   static Slot Make(const int rank, const size_t suit_index)
+   {
+      return T(rank, suit_index);
+   }
+
+   /// @brief Copy a card from a pile. This is just a byte copy.
+   /// @param slot The card we want to copy.
+   /// @return The copied card.
+   static Slot Copy(const Slot& slot) { return slot; }
+};
+
+template<>
+struct CardStorage<PackedStandardPlayingCard>:
+   PackedCardStorage<PackedStandardPlayingCard> {};
+template<>
+struct CardStorage<PackedPolarStandardPlayingCard>:
+   PackedCardStorage<PackedPolarStandardPlayingCard> {};
+
+/// @brief Whether the card type can be face down.
+/// @tparam T The type of card.
+template<typename T>
+struct IsPolarCard: std::integral_constant<bool,
+   std::is_same<T, PolarStandardPlayingCard>::value ||
+   std::is_same<T, PackedPolarStandardPlayingCard>::value> {};
+
+/// @brief One card as it sits in a pile.
+/// @tparam T This should be one of the standard playing card types.
+template<typename T>
+using CardSlot = typename CardStorage<T>::Slot;
+/// @brief A "pile" of cards. A pile never holds more than one deck, so the
+///        slots are kept inside it and a pile never allocates.
+/// @tparam T This should be one of the standard playing card types.
+template<typename T>
+using Pile = InlinePile<CardSlot<T>, 52>;
+static_assert(std::is_trivially_copyable<
+                 Pile<PackedPolarStandardPlayingCard>>::value,
+              "A pile of packed cards must be copyable with memcpy.");
 /// @brief A split deck is a deck that is split into two halves.
-/// @tparam T This should be either PolarStandardPlayingCard or
-///           StandardPlayingCard. May expand later.
+/// @tparam T This should be one of the standard playing card types.
 template<typename T>
 using SplitDeck = std::pair<Pile<T>, Pile<T>>;
+
+/// @brief How two halves of a deck are put back together.
+enum class RiffleType : uint8_t
+{
+   // The top half goes under the bottom half.
+   cut,
+   // The cards fall one from each half in turn.
+   perfect,
+   // Each card falls from either half with a chance of one half.
+   random,
+   // Each card falls from a half with a chance in proportion to how many
+   // cards that half has left.
+   gilbert_shannon_reeds
+};
+
+/// @brief Which half drops its bottom card first in a riffle.
+enum class RiffleDownFirst : uint8_t
+{
+   bottom,
+   top,
+   random
+};
+
+/// @brief Pass this as the amount of cards to cut for a random cut.
+inline constexpr size_t random_cut = static_cast<size_t>(-1);
 // ----------------------------------------------------------------------------
 
 // ----------------------------------------------------------------------------
@@ -38,8 +152,7 @@ using SplitDeck = std::pair<Pile<T>, Pile<T>>;
 // ----------------------------------------------------------------------------
 
 /// @brief This is a class for a standard playing card deck.
-/// @tparam T This should be either PolarStandardPlayingCard or
-///           StandardPlayingCard. May expand later.
+/// @tparam T This should be one of the standard playing card types.
 template<typename T>
 class StandardDeck
 {
@@ -54,6 +167,120 @@ class StandardDeck
       //
       // NOTE: The top of the deck is the back.
       mutable Pile<T> deck;
+      // The generator for every shuffle, riffle and cut. Each deck gets a
+      // fresh seed unless "SetSeed" is used.
+      Random::Xoshiro256 rng;
+      // The pile riffles are merged into. It is swapped with the deck so its
+      // memory is reused for the next riffle.
+      Pile<T> spare;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Private Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Put two runs of cards together into "out" from the bottom
+      ///        up. The cards are moved and each run is read once from front
+      ///        to back, so this is one pass over the cards.
+      /// @param first The bottom half.
+      /// @param first_size The amount of cards in the bottom half.
+      /// @param second The top half.
+      /// @param second_size The amount of cards in the top half.
+      /// @param out Where the cards go. It is cleared first.
+      /// @param type How the halves are put together.
+      /// @param down_first Which half drops its bottom card first.
+      void Merge(CardSlot<T>*          first,
+                 const size_t          first_size,
+                 CardSlot<T>*          second,
+                 const size_t          second_size,
+                 Pile<T>&              out,
+                 const RiffleType      type,
+                 const RiffleDownFirst down_first)
+      {
+         out.clear();
+
+         // If the type is just a cut then put the top half (second) on the
+         // bottom and the bottom half (first) on top.
+         if (type == RiffleType::cut)
+         {
+            std::move(second, second + second_size, std::back_inserter(out));
+            std::move(first, first + first_size, std::back_inserter(out));
+            return;
+         }
+
+         // Whether the next card comes from the bottom half.
+         bool from_first = down_first == RiffleDownFirst::bottom ||
+                           (down_first == RiffleDownFirst::random &&
+                            (rng() >> 63) == 0);
+
+         // Coin flips for a random riffle are taken 64 at a time.
+         uint64_t coins      = 0;
+         size_t   coins_left = 0;
+
+         // The cards are written by index so the loop does not check the
+         // capacity for every card.
+         out.resize(first_size + second_size);
+         size_t a = 0;
+         size_t b = 0;
+         while (a < first_size && b < second_size)
+         {
+            if (type == RiffleType::random && a + b > 0)
+            {
+               if (coins_left == 0)
+               {
+                  coins      = rng();
+                  coins_left = 64;
+               }
+               from_first = (coins & 1) == 0;
+               coins >>= 1;
+               coins_left--;
+            }
+            else if (type == RiffleType::gilbert_shannon_reeds)
+            {
+               const size_t first_left = first_size - a;
+               const size_t total_left = first_left + second_size - b;
+               from_first = Random::Below(rng, static_cast<uint32_t>(
+                               total_left)) < first_left;
+            }
+
+            // Pick the card without a branch. Random riffles would guess the
+            // branch wrong half the time.
+            CardSlot<T>& card = from_first ? first[a] : second[b];
+            out[a + b] = std::move(card);
+            a += from_first;
+            b += !from_first;
+
+            if (type == RiffleType::perfect)
+            {
+               from_first = !from_first;
+            }
+         }
+
+         // One half ran out so the rest of the other falls on top.
+         auto rest = std::move(first + a, first + first_size,
+                               out.begin() + (a + b));
+         std::move(second + b, second + second_size, rest);
+      }
+
+      /// @brief Get a cut for a Gilbert-Shannon-Reeds riffle. This is the
+      ///        amount of heads in one coin flip per card.
+      /// @return The amount of cards in the bottom half.
+      size_t BinomialCut()
+      {
+         size_t mid = 0;
+         for (size_t left = deck.size(); left > 0;)
+         {
+            const size_t flips = std::min<size_t>(left, 64);
+            uint64_t     coins = rng();
+            if (flips < 64)
+            {
+               coins &= (uint64_t(1) << flips) - 1;
+            }
+            mid  += static_cast<size_t>(__builtin_popcountll(coins));
+            left -= flips;
+         }
+         return mid;
+      }
       // ----------------------------------------------------------------------
    
    public:
@@ -62,61 +289,82 @@ class StandardDeck
       // ----------------------------------------------------------------------
 
       /// @brief Standard constructor.
-      StandardDeck()
+      StandardDeck(): rng(Random::FreshSeed())
       {
          // We should only be making "StandardDecks" with standard cards.
          static_assert(std::is_same<T, StandardPlayingCard>::value || 
-                       std::is_same<T, PolarStandardPlayingCard>::value,
+                       std::is_same<T, PolarStandardPlayingCard>::value ||
+                       std::is_same<T, PackedStandardPlayingCard>::value ||
+                       std::is_same<T, PackedPolarStandardPlayingCard>::value,
                        "StandardDeck can only be instantiated with"
-                       "StandardPlayingCard or\n"
-                       "PolarStandardPlayingCard.");
-
-         // Deck of 52 cards can maybe be expanded later.
-         deck.reserve(52);
+                       "StandardPlayingCard,\n"
+                       "PolarStandardPlayingCard or their packed versions.");
 
          // Create all the cards. This is basically like openning a fresh
          // pack of cards.
-         for (const auto& suit : CardGraphicsAndInfo::suits)
+         const size_t suit_count = CardGraphicsAndInfo::suits.size();
+         for (size_t suit = 0; suit < suit_count; suit++)
          {
             for (const auto& rank : CardGraphicsAndInfo::ranks)
             {
-               deck.push_back(std::make_unique<T>(rank,suit));
+               deck.push_back(CardStorage<T>::Make(rank,suit));
             }
          }
       }
 
       /// @brief The copy constructor. Basically magic. Making cards from thin
-      ///        air.
+      ///        air. The copy gets a fresh seed so it doesn't shuffle the
+      ///        same way as the original.
       /// @param copy The instance we want to copy.
-      StandardDeck(const StandardDeck<T> &copy)
+      StandardDeck(const StandardDeck<T> &copy): rng(Random::FreshSeed())
       {
-         // It's a copy so only need the same amount.
-         deck.reserve(copy.deck.size());
-
-         // Push back uniques pointers copying the cards.
-         for (const auto& ptr : copy.deck) 
+         // Push back copies of the cards.
+         for (const auto& slot : copy.deck) 
          {
-            if (ptr)
-            {
-               deck.push_back(std::make_unique<T>(*ptr));
-            }
-            else
-            {
-               deck.push_back(nullptr);
-            }
+            deck.push_back(CardStorage<T>::Copy(slot));
          }
       }
       
       /// @brief Custom constructor to make a deck from a vector.
       /// @param pile The pile of cards we want to make our deck.
-      StandardDeck(const Pile<T> pile): deck(std::move(pile)) {};
+      StandardDeck(Pile<T> pile):
+         deck(std::move(pile)), rng(Random::FreshSeed())
+      {};
 
       /// @brief The move constructor.
       /// @param move The instance we would like to move.
       StandardDeck(StandardDeck<T> &&move) noexcept: 
-         deck(std::move(move.deck)) 
+         deck(std::move(move.deck)), rng(move.rng)
       {};
 
+      /// @brief Make a deck from card ids. See
+      ///        "PackedStandardPlayingCard::GetId".
+      /// @param ids The ids, bottom of the deck first.
+      /// @param count The amount of ids. It must be at most 52.
+      /// @return The deck.
+      static StandardDeck<T> FromIds(const uint8_t* ids, const size_t count)
+      {
+         Pile<T> pile;
+         for (size_t i = 0; i < count; i++)
+         {
+            pile.push_back(CardStorage<T>::Make(ids[i] % 13 + 1, ids[i] / 13));
+         }
+         return StandardDeck<T>(std::move(pile));
+      }
+
+      /// @brief Make a deck from its rank. See "DealRank".
+      /// @param rank The rank.
+      /// @return The deck. It is empty if the rank is 52! or more.
+      static StandardDeck<T> FromDealRank(const DealRank::Rank& rank)
+      {
+         uint8_t ids[DealRank::deal_size];
+         if (!DealRank::Decode(rank, ids))
+         {
+            return StandardDeck<T>(Pile<T>());
+         }
+         return FromIds(ids, DealRank::deal_size);
+      }
+
       /// @brief The default destructor.
       ~StandardDeck() = default;
       // ----------------------------------------------------------------------
@@ -134,6 +382,7 @@ class StandardDeck
          if (this != &other)
          {
             deck = std::move(other.deck);
+            rng  = other.rng;
          }
          return *this;
       }
@@ -146,6 +395,30 @@ class StandardDeck
       /// @brief Get the deck that this class represents.
       /// @return Return the reference to the deck.
       const Pile<T>& GetDeck() const { return deck; };
+
+      /// @brief Get the order of the deck as a number. See "DealRank".
+      /// @param out Where the rank goes.
+      /// @return False if the deck is not all 52 cards once each.
+      bool GetDealRank(DealRank::Rank& out) const
+      {
+         if (deck.size() != DealRank::deal_size)
+         {
+            return false;
+         }
+
+         uint8_t ids[DealRank::deal_size];
+         for (size_t i = 0; i < deck.size(); i++)
+         {
+            if (!deck[i])
+            {
+               return false;
+            }
+            ids[i] = static_cast<uint8_t>(
+               static_cast<size_t>(deck[i]->GetSuitType()) * 13 +
+               deck[i]->GetRank() - 1);
+         }
+         return DealRank::Encode(ids, out);
+      }
       // ----------------------------------------------------------------------
 
       // ----------------------------------------------------------------------
@@ -159,24 +432,26 @@ class StandardDeck
       {
          // We should only be making "StandardDecks" with standard cards.
          static_assert(std::is_same<T, StandardPlayingCard>::value || 
-                       std::is_same<T, PolarStandardPlayingCard>::value,
+                       std::is_same<T, PolarStandardPlayingCard>::value ||
+                       std::is_same<T, PackedStandardPlayingCard>::value ||
+                       std::is_same<T, PackedPolarStandardPlayingCard>::value,
                        "StandardDeck can only be instantiated with"
-                       "StandardPlayingCard or\n"
-                       "PolarStandardPlayingCard.");
+                       "StandardPlayingCard,\n"
+                       "PolarStandardPlayingCard or their packed versions.");
 
          // Clear our deck for now.
          deck.clear();
-         // Get the piles size.
-         size_t size = pile.size();
-         // Reserve the memory for faster processing.
-         deck.reserve(size);
-
          // Move the pile.
          deck = std::move(pile);
 
          // Clear the memory.
          pile.clear();
       }
+
+      /// @brief Seed the generator so every shuffle, riffle and cut from now
+      ///        on happens the same way each run.
+      /// @param seed The seed.
+      void SetSeed(const uint64_t seed) { rng.Seed(seed); }
       // ----------------------------------------------------------------------
 
       // ----------------------------------------------------------------------
@@ -185,18 +460,26 @@ class StandardDeck
 
       /// @brief Draw one card from the top of the deck.
       /// @return Returns the card.
-      std::unique_ptr<T> DrawOne()
+      CardSlot<T> DrawOne()
       {
          if (deck.size() == 0)
          {
-            return nullptr;
+            return CardSlot<T>();
          }
 
-         std::unique_ptr<T> out = std::move(deck.back());
+         CardSlot<T> out = std::move(deck.back());
          deck.pop_back();
          return out;
       }
 
+      /// @brief Put a card back on the top of the deck. This is the opposite
+      ///        of "DrawOne".
+      /// @param card The card.
+      void PutBack(CardSlot<T> card)
+      {
+         deck.push_back(std::move(card));
+      }
+
       /// @brief Draws more than one card
       /// @param amount The amount of cards that are to be drawn from the top
       ///               of the deck.
@@ -211,8 +494,6 @@ class StandardDeck
 
          // Initialize the return pile.
          Pile<T> out;
-         // Reserve the amount of cards.
-         out.reserve(amount);
          // Take cards off the top.
          for (size_t i = 0; i < amount; i++)
          {
@@ -235,10 +516,6 @@ class StandardDeck
          Pile<T> pile1;
          Pile<T> pile2;
 
-         // Reserve the memory.
-         pile1.reserve(mid);
-         pile2.reserve(deck.size() - mid);
-
          // Get the middle iter because we will do this move fast.
          auto mid_iter = deck.begin();
          std::advance(mid_iter,mid);
@@ -260,166 +537,113 @@ class StandardDeck
 
       /// @brief This function will take a split deck and put it together.
       /// @param halves This is the actual split deck we would like to put
-      ///                together.
-      /// @param type_input 
-      /// @param down_first_input 
+      ///                together. First is the bottom half.
+      /// @param type How the halves are put together.
+      /// @param down_first Which half drops its bottom card first. This does
+      ///                   nothing for a cut or a Gilbert-Shannon-Reeds
+      ///                   riffle.
       /// @return Returns the piles put together into one.
-      Pile<T> PutHalvesTogether(SplitDeck<T>      halves,
-                                const std::string type_input,
-                                const std::string down_first_input = "random")
+      Pile<T> PutHalvesTogether(
+         SplitDeck<T>          halves,
+         const RiffleType      type,
+         const RiffleDownFirst down_first = RiffleDownFirst::random)
       {
-         // Get the total number of cards.
-         size_t total = halves.first.size() + halves.second.size();
-         // Initialize the return variable.
          Pile<T> out;
-         // Reserve the memory for faster processing.
-         out.reserve(total);
-
-         // If the type is just a cut then put the top half (second) on the
-         // bottom and the bottom half (first) on top.
-         if (type_input == "cut")
-         {
-            std::move(std::make_move_iterator(halves.second.begin()),
-                     std::make_move_iterator(halves.second.end()),
-                     std::back_inserter(out));
-            std::move(std::make_move_iterator(halves.first.begin()),
-                     std::make_move_iterator(halves.first.end()),
-                     std::back_inserter(out));
-         }
-         else 
-         {
-            // DEBUG
-            //std::cout << "Inside correct if statement.\n";
-
-            // Get our random numbers set up.
-            std::random_device rd;
-            std::mt19937 rng(rd());
-            std::uniform_int_distribution<std::mt19937::result_type> dist1(0,1);
-
-            // This is for which half of the deck should go down first.
-            int add = 0;
-            if (down_first_input == "top" ||
-                (down_first_input == "random" && dist1(rng) == 1))
-            {
-               add = 1;
-            }
-            
-            // This does all the figuring of which one goes in first if 
-            // it is not a cut.
-            for (size_t i = add; i < total + add; i++)
-            {
-               // DEBUG
-               //std::cout << type_input << " " << dist1(rng) << std::endl;
-
-               // If the type input is perfect and the bottom should go down
-               // first or it is random and we got the random 0 from the rng
-               // or bottom was specified or the top half is just empty.
-               // Also make sure it has cards too.
-               if (((type_input == "perfect" && i % 2 == 0) ||
-                    (type_input == "random" && dist1(rng) == 0) ||
-                    (down_first_input == "bottom" && i == 0) ||
-                    (halves.second.size() == 0)) &&
-                   halves.first.size() > 0)
-               {
-                  // DEBUG
-                  //std::cout << "Bottom.\n";
-                  //std::cout << i << ": " <<  halves.first[0]->GetRank() << " of " 
-                  //          << halves.first[0]->GetSuit() << "s.\n";
-
-                  out.push_back(std::move(halves.first[0]));
-                  halves.first.erase(halves.first.begin());
-               }
-               else if (halves.second.size() > 0)
-               {
-                  // DEBUG
-                  //std::cout << "Top.\n";
-                  //std::cout << i << ": " << halves.second[0]->GetRank() << " of " 
-                  //          << halves.second[0]->GetSuit() << "s.\n";
-
-                  out.push_back(std::move(halves.second[0]));
-                  halves.second.erase(halves.second.begin());
-               }
-            }
-         }
-
-         // Clear the memory.
-         halves.first.clear();
-         halves.second.clear();
-         // Return the pile.
+         Merge(halves.first.data(), halves.first.size(),
+               halves.second.data(), halves.second.size(),
+               out, type, down_first);
          return out;
       } // PutHalvesTogether
 
       /// @brief Cut the deck.
       /// @param mid This is a perfect cut which is default, but otherwise
       ///            You can specify the amount of cards to cut.
-      ///            If "mid" = '-1' then the cut will be random.
+      ///            If "mid" is "random_cut" then the cut will be random.
       ///            "mid" is also the amount of cards that will be cut from
       ///            the bottom.
       void Cut(size_t mid = 26)
       {
+         ALLOCATION_SCOPE(shuffle);
+
          // Determine the amount of cards to cut.
-         if (mid >= deck.size())
+         if (mid == random_cut)
          {
-            mid = deck.size() / 2;
+            mid = Random::Below(rng, static_cast<uint32_t>(deck.size() + 1));
          }
-
-         if (mid < 0)
+         else if (mid >= deck.size())
          {
-            mid = std::rand() % 52;
+            mid = deck.size() / 2;
          }
 
-         // Split the deck, and put it back together.
-         SetDeck(PutHalvesTogether(Split(mid), "cut"));
+         // Put the cards cut from the bottom on top.
+         std::rotate(deck.begin(), deck.begin() + mid, deck.end());
       }
 
       /// @brief This represents a riffle shuffle.
       /// @param mid This is a perfect cut which is default, but otherwise
       ///            You can specify the amount of cards to cut.
-      ///            If "mid" = '-1' then the cut will be random.
+      ///            If "mid" is "random_cut" then the cut will be random.
       ///            "mid" is also the amount of cards that will be cut from
       ///            the bottom.
-      /// @param down_first_input Which card will fall down first.
-      /// @param type_input This will be either 'perfect' or 'random' to 
-      ///                   simulate a perfect riffle shuffle or just one done
-      ///                   Leisurely.
-      void Riffle(size_t            mid = 26,
-                  const std::string down_first_input = "bottom",
-                  const std::string type_input = "perfect")
+      /// @param down_first Which half drops its bottom card first.
+      /// @param type This will be either "perfect" or "random" to simulate a
+      ///             perfect riffle shuffle or just one done leisurely, or
+      ///             "gilbert_shannon_reeds" for the usual model of how
+      ///             people riffle.
+      void Riffle(size_t                mid        = 26,
+                  const RiffleDownFirst down_first = RiffleDownFirst::bottom,
+                  const RiffleType      type       = RiffleType::perfect)
       {
-         // Get the random numbers.
-         std::random_device rd;
-         std::mt19937 rng(rd());
-         std::uniform_int_distribution<std::mt19937::result_type> dist1(0,1);
-         std::uniform_int_distribution<std::mt19937::result_type> dist51(0,51);
+         ALLOCATION_SCOPE(shuffle);
+
          // Get the mid point.
-         if (mid < 0)
+         if (mid == random_cut)
          {
-            mid = dist51(rng);
+            mid = Random::Below(rng, static_cast<uint32_t>(deck.size() + 1));
          }
+         mid = std::min(mid, deck.size());
+
+         // Merge into the spare pile and swap it in. Once both have grown to
+         // the size of the deck this allocates nothing.
+         Merge(deck.data(), mid, deck.data() + mid, deck.size() - mid,
+               spare, type, down_first);
+         deck.swap(spare);
+         spare.clear();
+      } // Riffle
 
-         // Get which card should go down first.
-         // Could be specified or random.
-         if (down_first_input == "bottom" ||  
-             (down_first_input == "random" &&
-              dist1(rng) == 0))
-         {
-            SetDeck(PutHalvesTogether(Split(mid), type_input, "bottom"));
-         }
-         else
+      /// @brief Riffle the deck the way the Gilbert-Shannon-Reeds model says
+      ///        people do. The deck is cut binomially, so each card is in
+      ///        the bottom half with a chance of one half, and then each card
+      ///        drops from a half with a chance in proportion to how many
+      ///        cards that half has left. Seven of these mix a deck of 52.
+      /// @param times How many riffles to do.
+      void RiffleGilbertShannonReeds(const size_t times = 1)
+      {
+         for (size_t i = 0; i < times; i++)
          {
-            SetDeck(PutHalvesTogether(Split(mid), type_input, "top"));
+            Riffle(BinomialCut(), RiffleDownFirst::bottom,
+                   RiffleType::gilbert_shannon_reeds);
          }
-      } // Riffle
+      }
 
-      /// @brief This function just entirely randomizes the deck.
+      /// @brief This function just entirely randomizes the deck with the
+      ///        deck's own generator.
       void RandomizeDeck()
       {
-         // Random setup.
-         std::random_device rd;
-         std::mt19937 rng(rd());
+         ALLOCATION_SCOPE(shuffle);
+         Random::Shuffle(deck.begin(), deck.end(), rng);
+      }
 
-         // Shuffle.
-         std::shuffle(deck.begin(), deck.end(), rng);
+      /// @brief Randomize the deck with a generator we were given. The same
+      ///        generator state always gives the same order.
+      /// @tparam Generator A generator giving 32 or 64 random bits per call,
+      ///                   like "Random::Xoshiro256" or "std::mt19937_64".
+      /// @param generator The generator to shuffle with.
+      template<typename Generator>
+      void RandomizeDeck(Generator& generator)
+      {
+         ALLOCATION_SCOPE(shuffle);
+         Random::Shuffle(deck.begin(), deck.end(), generator);
       }
       // ----------------------------------------------------------------------
 }; // StandardDeck
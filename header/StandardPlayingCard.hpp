@@ -37,7 +37,7 @@ class StandardPlayingCard
       // This is all the cosmetic and descriptive information.
       //
       // The graphic of the card.
-      SetOnce<std::vector<std::string>> graphic;
+      SetOnce<CardGraphicsAndInfo::CardArt> graphic;
       // The rank 1 through 13.
       SetOnce<int>         rank;
       // The suit spade, heart, club, or diamond.
@@ -51,8 +51,8 @@ class StandardPlayingCard
       /// @brief Take the rank and suit and find the correct graphic for them.
       /// @param rank_input The rank of the card to be found.
       /// @param suit_input The suit of the card to be found.
-      /// @return Return the string vector of the graphic.
-      std::vector<std::string> FindGraphic(const int         rank_input, 
+      /// @return Return the rows of the graphic.
+      CardGraphicsAndInfo::CardArt FindGraphic(const int         rank_input, 
                                            const std::string suit_input)
       {
          // Initialize the indices.
@@ -68,7 +68,7 @@ class StandardPlayingCard
             }
          }
          // find the suit.
-         for (size_t i = 0; i < CardGraphicsAndInfo::ranks.size(); i++)
+         for (size_t i = 0; i < CardGraphicsAndInfo::suits.size(); i++)
          {
             if (suit_input == CardGraphicsAndInfo::suits[i])
             {
@@ -181,8 +181,8 @@ class StandardPlayingCard
       // ----------------------------------------------------------------------
 
       /// @brief Get the graphic for displaying the card.
-      /// @return Returns the graphic string vector.
-      const std::vector<std::string> GetGraphic() const 
+      /// @return Returns the rows of the graphic.
+      const CardGraphicsAndInfo::CardArt& GetGraphic() const 
       { 
          return graphic.Get(); 
       }
@@ -206,6 +206,27 @@ class StandardPlayingCard
          
          return "black";
       }
+
+      /// @brief Get the suit of the card as a value. This card keeps its
+      ///        suit as a name so the name is looked up.
+      /// @return Return the suit.
+      CardGraphicsAndInfo::Suit GetSuitType() const
+      {
+         size_t index = 0;
+         while (index < 3 && suit.Get() != CardGraphicsAndInfo::suits[index])
+         {
+            index++;
+         }
+
+         return static_cast<CardGraphicsAndInfo::Suit>(index);
+      }
+
+      /// @brief Get the color of the suit as a value.
+      /// @return Returns the color of the suit.
+      CardGraphicsAndInfo::Color GetColorType() const
+      {
+         return CardGraphicsAndInfo::GetSuitColor(GetSuitType());
+      }
       // ----------------------------------------------------------------------
 }; // StandardPlayingCard
 // ----------------------------------------------------------------------------
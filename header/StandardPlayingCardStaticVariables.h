@@ -6,8 +6,10 @@
 // ----------------------------------------------------------------------------
 
 // Standard library includes.
-#include <vector>
-#include <iostream>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
 // ----------------------------------------------------------------------------
 
 // ----------------------------------------------------------------------------
@@ -15,510 +17,363 @@
 // ----------------------------------------------------------------------------
 
 /// @brief This is all of the cards information. This is 
-///        basically a look up table.
+///        basically a look up table. Every table is made at compile time
+///        so nothing runs when the program starts and every file shares the
+///        same copy.
 namespace CardGraphicsAndInfo
 {
-// All of the graphics for the cards.
-static const std::vector<
-             std::vector<
-             std::vector<
-             std::string>>> graphics = {{{{"+-----------+"},
-                                          {"|A          |"},
-                                          {"|\xe2\x99\xa0          |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa0     |"},
-                                          {"|           |"},
-                                          {"|          \xe2\x99\xa0|"},
-                                          {"|          A|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|2          |"},
-                                          {"|\xe2\x99\xa0    \xe2\x99\xa0     |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa0    \xe2\x99\xa0|"},
-                                          {"|          2|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|3          |"},
-                                          {"|\xe2\x99\xa0    \xe2\x99\xa0     |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa0     |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa0    \xe2\x99\xa0|"},
-                                          {"|          3|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|4          |"},
-                                          {"|\xe2\x99\xa0  \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0  \xe2\x99\xa0|"},
-                                          {"|          4|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|5          |"},
-                                          {"|\xe2\x99\xa0  \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa0     |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0  \xe2\x99\xa0|"},
-                                          {"|          5|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|6          |"},
-                                          {"|\xe2\x99\xa0  \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0  \xe2\x99\xa0|"},
-                                          {"|          6|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|7          |"},
-                                          {"|\xe2\x99\xa0  \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|     \xe2\x99\xa0     |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0  \xe2\x99\xa0|"},
-                                          {"|          7|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|8          |"},
-                                          {"|\xe2\x99\xa0  \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|     \xe2\x99\xa0     |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|     \xe2\x99\xa0     |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0  \xe2\x99\xa0|"},
-                                          {"|          8|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|9  \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|\xe2\x99\xa0          |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|     \xe2\x99\xa0     |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|          \xe2\x99\xa0|"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0  9|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|10 \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|\xe2\x99\xa0    \xe2\x99\xa0     |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0   |"},
-                                          {"|     \xe2\x99\xa0    \xe2\x99\xa0|"},
-                                          {"|   \xe2\x99\xa0   \xe2\x99\xa0 10|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|J \xe2\x99\xa0 JJJ J  |"},
-                                          {"|\xe2\x99\xa0   JJO J  |"},
-                                          {"|   J   JJ  |"},
-                                          {"|  J  J  J  |"},
-                                          {"|  JJ   J   |"},
-                                          {"|  J OJJ   \xe2\x99\xa0|"},
-                                          {"|  J JJJ \xe2\x99\xa0 J|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|Q \xe2\x99\xa0 QQQ    |"},
-                                          {"|\xe2\x99\xa0 Q QOO    |"},
-                                          {"|   Q   Q   |"},
-                                          {"|  Q  Q  Q  |"},
-                                          {"|   Q Q Q   |"},
-                                          {"|    OOQ Q \xe2\x99\xa0|"},
-                                          {"|    QQQ \xe2\x99\xa0 Q|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|K \xe2\x99\xa0 KKK K  |"},
-                                          {"|\xe2\x99\xa0   KOO K  |"},
-                                          {"|   K   K   |"},
-                                          {"|  K K K K  |"},
-                                          {"|   K K K   |"},
-                                          {"|  K OOK   \xe2\x99\xa0|"},
-                                          {"|  K KKK \xe2\x99\xa0 K|"},
-                                          {"+-----------+"}}},
-                                        {{{"+-----------+"},
-                                          {"|A          |"},
-                                          {"|\xe2\x99\xa5          |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa5     |"},
-                                          {"|           |"},
-                                          {"|          \xe2\x99\xa5|"},
-                                          {"|          A|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|2          |"},
-                                          {"|\xe2\x99\xa5    \xe2\x99\xa5     |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa5    \xe2\x99\xa5|"},
-                                          {"|          2|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|3          |"},
-                                          {"|\xe2\x99\xa5    \xe2\x99\xa5     |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa5     |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa5    \xe2\x99\xa5|"},
-                                          {"|          3|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|4          |"},
-                                          {"|\xe2\x99\xa5  \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5  \xe2\x99\xa5|"},
-                                          {"|          4|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|5          |"},
-                                          {"|\xe2\x99\xa5  \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa5     |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5  \xe2\x99\xa5|"},
-                                          {"|          5|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|6          |"},
-                                          {"|\xe2\x99\xa5  \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5  \xe2\x99\xa5|"},
-                                          {"|          6|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|7          |"},
-                                          {"|\xe2\x99\xa5  \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|     \xe2\x99\xa5     |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5  \xe2\x99\xa5|"},
-                                          {"|          7|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|8          |"},
-                                          {"|\xe2\x99\xa5  \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|     \xe2\x99\xa5     |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|     \xe2\x99\xa5     |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5  \xe2\x99\xa5|"},
-                                          {"|          8|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|9  \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|\xe2\x99\xa5          |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|     \xe2\x99\xa5     |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|          \xe2\x99\xa5|"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5  9|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|10 \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|\xe2\x99\xa5    \xe2\x99\xa5     |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5   |"},
-                                          {"|     \xe2\x99\xa5    \xe2\x99\xa5|"},
-                                          {"|   \xe2\x99\xa5   \xe2\x99\xa5 10|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|J \xe2\x99\xa5 JJJ J  |"},
-                                          {"|\xe2\x99\xa5 J OJJ J  |"},
-                                          {"|   J   JJ  |"},
-                                          {"|  J  J  J  |"},
-                                          {"|  JJ   J   |"},
-                                          {"|  J JJO J \xe2\x99\xa5|"},
-                                          {"|  J JJJ \xe2\x99\xa5 J|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|Q \xe2\x99\xa5 QQQ    |"},
-                                          {"|\xe2\x99\xa5   OOQ Q  |"},
-                                          {"|   Q   Q   |"},
-                                          {"|  Q  Q  Q  |"},
-                                          {"|   Q Q Q   |"},
-                                          {"|  Q QOO   \xe2\x99\xa5|"},
-                                          {"|    QQQ \xe2\x99\xa5 Q|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|K \xe2\x99\xa5 KKK<K  |"},
-                                          {"|\xe2\x99\xa5   OOK K  |"},
-                                          {"|   K   K   |"},
-                                          {"|  K K K K  |"},
-                                          {"|   K K K   |"},
-                                          {"|  K KOO   \xe2\x99\xa5|"},
-                                          {"|  K>KKK \xe2\x99\xa5 K|"},
-                                          {"+-----------+"}}},
-                                        {{{"+-----------+"},
-                                          {"|A          |"},
-                                          {"|\xe2\x99\xa3          |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa3     |"},
-                                          {"|           |"},
-                                          {"|          \xe2\x99\xa3|"},
-                                          {"|          A|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|2          |"},
-                                          {"|\xe2\x99\xa3    \xe2\x99\xa3     |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa3    \xe2\x99\xa3|"},
-                                          {"|          2|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|3          |"},
-                                          {"|\xe2\x99\xa3    \xe2\x99\xa3     |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa3     |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa3    \xe2\x99\xa3|"},
-                                          {"|          3|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|4          |"},
-                                          {"|\xe2\x99\xa3  \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3  \xe2\x99\xa3|"},
-                                          {"|          4|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|5          |"},
-                                          {"|\xe2\x99\xa3  \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa3     |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3  \xe2\x99\xa3|"},
-                                          {"|          5|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|6          |"},
-                                          {"|\xe2\x99\xa3  \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3  \xe2\x99\xa3|"},
-                                          {"|          6|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|7          |"},
-                                          {"|\xe2\x99\xa3  \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|     \xe2\x99\xa3     |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3  \xe2\x99\xa3|"},
-                                          {"|          7|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|8          |"},
-                                          {"|\xe2\x99\xa3  \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|     \xe2\x99\xa3     |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|     \xe2\x99\xa3     |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3  \xe2\x99\xa3|"},
-                                          {"|          8|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|9  \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|\xe2\x99\xa3          |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|     \xe2\x99\xa3     |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|          \xe2\x99\xa3|"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3  9|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|10 \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|\xe2\x99\xa3    \xe2\x99\xa3     |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3   |"},
-                                          {"|     \xe2\x99\xa3    \xe2\x99\xa3|"},
-                                          {"|   \xe2\x99\xa3   \xe2\x99\xa3 10|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|J \xe2\x99\xa3 JJJ J  |"},
-                                          {"|\xe2\x99\xa3   JOO J  |"},
-                                          {"|   J   JJ  |"},
-                                          {"|  J  J  J  |"},
-                                          {"|  JJ   J   |"},
-                                          {"|  J OOJ   \xe2\x99\xa3|"},
-                                          {"|  J JJJ \xe2\x99\xa3 J|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|Q \xe2\x99\xa3 QQQ    |"},
-                                          {"|\xe2\x99\xa3 Q OOQ    |"},
-                                          {"|   Q   Q   |"},
-                                          {"|  Q  Q  Q  |"},
-                                          {"|   Q Q Q   |"},
-                                          {"|    QOO Q \xe2\x99\xa3|"},
-                                          {"|    QQQ \xe2\x99\xa3 Q|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|K \xe2\x99\xa3 KKK K  |"},
-                                          {"|\xe2\x99\xa3   OOK K  |"},
-                                          {"|   K   K   |"},
-                                          {"|  K K K K  |"},
-                                          {"|   K K K   |"},
-                                          {"|  K KOO   \xe2\x99\xa3|"},
-                                          {"|  K KKK \xe2\x99\xa3 K|"},
-                                          {"+-----------+"}}},
-                                        {{{"+-----------+"},
-                                          {"|A          |"},
-                                          {"|\xe2\x99\xa6          |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa6     |"},
-                                          {"|           |"},
-                                          {"|          \xe2\x99\xa6|"},
-                                          {"|          A|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|2          |"},
-                                          {"|\xe2\x99\xa6    \xe2\x99\xa6     |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa6    \xe2\x99\xa6|"},
-                                          {"|          2|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|3          |"},
-                                          {"|\xe2\x99\xa6    \xe2\x99\xa6     |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa6     |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa6    \xe2\x99\xa6|"},
-                                          {"|          3|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|4          |"},
-                                          {"|\xe2\x99\xa6  \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6  \xe2\x99\xa6|"},
-                                          {"|          4|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|5          |"},
-                                          {"|\xe2\x99\xa6  \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|           |"},
-                                          {"|     \xe2\x99\xa6     |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6  \xe2\x99\xa6|"},
-                                          {"|          5|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|6          |"},
-                                          {"|\xe2\x99\xa6  \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6  \xe2\x99\xa6|"},
-                                          {"|          6|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|7          |"},
-                                          {"|\xe2\x99\xa6  \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|     \xe2\x99\xa6     |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6  \xe2\x99\xa6|"},
-                                          {"|          7|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|8          |"},
-                                          {"|\xe2\x99\xa6  \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|     \xe2\x99\xa6     |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|     \xe2\x99\xa6     |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6  \xe2\x99\xa6|"},
-                                          {"|          8|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|9  \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|\xe2\x99\xa6          |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|     \xe2\x99\xa6     |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|          \xe2\x99\xa6|"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6  9|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|10 \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|\xe2\x99\xa6    \xe2\x99\xa6     |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|           |"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6   |"},
-                                          {"|     \xe2\x99\xa6    \xe2\x99\xa6|"},
-                                          {"|   \xe2\x99\xa6   \xe2\x99\xa6 10|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|J \xe2\x99\xa6 JJJ J  |"},
-                                          {"|\xe2\x99\xa6   OOJ J  |"},
-                                          {"|   J   JJ  |"},
-                                          {"|  J  J  J  |"},
-                                          {"|  JJ   J   |"},
-                                          {"|  J JOO   \xe2\x99\xa6|"},
-                                          {"|  J JJJ \xe2\x99\xa6 J|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|Q \xe2\x99\xa6 QQQ    |"},
-                                          {"|\xe2\x99\xa6 Q OOQ    |"},
-                                          {"|   Q   Q   |"},
-                                          {"|  Q  Q  Q  |"},
-                                          {"|   Q Q Q   |"},
-                                          {"|    QOO Q \xe2\x99\xa6|"},
-                                          {"|    QQQ \xe2\x99\xa6 Q|"},
-                                          {"+-----------+"}},
-                                         {{"+-----------+"},
-                                          {"|K \xe2\x99\xa6 KKK K  |"},
-                                          {"|\xe2\x99\xa6   OKK K  |"},
-                                          {"|   K   K   |"},
-                                          {"|  K K K K  |"},
-                                          {"|   K K K   |"},
-                                          {"|  K KKO   \xe2\x99\xa6|"},
-                                          {"|  K KKK \xe2\x99\xa6 K|"},
-                                          {"+-----------+"}}}};
+// The amount of rows in every card graphic.
+inline constexpr size_t graphic_rows = 9;
+
+/// @brief The rows of one card graphic.
+using CardArt = std::array<std::string_view, graphic_rows>;
 
 // All of the ranks that a card can be.
-static const std::vector<int>         ranks = {1,2,3,4,5,6,7,8,9,10,11,12,13};
+inline constexpr std::array<int, 13> ranks = {1,2,3,4,5,6,7,8,9,10,11,12,13};
 
 // All of the suits a card can be.
-static const std::vector<std::string> suits = {"spade","heart","club","diamond"};
+inline constexpr std::array<std::string_view, 4> suits = {"spade","heart",
+                                                          "club","diamond"};
+
+// The suits as values instead of names. The order is the same as "suits" so
+// a suit is also its index there, and the red suits are the odd ones.
+enum class Suit : uint8_t
+{
+   spade,
+   heart,
+   club,
+   diamond
+};
+
+// The two colors of the suits.
+enum class Color : uint8_t
+{
+   black,
+   red
+};
+
+/// @brief Get the color of a suit. Red suits have the low bit set so this is
+///        a single bit test.
+/// @param suit The suit.
+/// @return The color of the suit.
+constexpr Color GetSuitColor(const Suit suit)
+{
+   return static_cast<Color>(static_cast<uint8_t>(suit) & 1);
+}
 
 // The back of a playing card.
-static const std::vector<std::string> back  = {{"+-----------+"},
-                                               {"|***********|"},
-                                               {"|****@@@****|"},
-                                               {"|***@###@***|"},
-                                               {"|**@<(o)>@**|"},
-                                               {"|***@###@***|"},
-                                               {"|****@@@****|"},
-                                               {"|***********|"},
-                                               {"+-----------+"}};
+inline constexpr CardArt back  = {"+-----------+",
+                                  "|***********|",
+                                  "|****@@@****|",
+                                  "|***@###@***|",
+                                  "|**@<(o)>@**|",
+                                  "|***@###@***|",
+                                  "|****@@@****|",
+                                  "|***********|",
+                                  "+-----------+"};
 
 // An empty slot graphic.
-static const std::vector<std::string> empty = {{"+-----------+"},
-                                               {"|*****^*****|"},
-                                               {"|****/ \\****|"},
-                                               {"|***/   \\***|"},
-                                               {"|**(     )**|"},
-                                               {"|***\\   /***|"},
-                                               {"|****\\ /****|"},
-                                               {"|*****v*****|"},
-                                               {"+-----------+"}};
+inline constexpr CardArt empty = {"+-----------+",
+                                  "|*****^*****|",
+                                  "|****/ \\****|",
+                                  "|***/   \\***|",
+                                  "|**(     )**|",
+                                  "|***\\   /***|",
+                                  "|****\\ /****|",
+                                  "|*****v*****|",
+                                  "+-----------+"};
+
+// ----------------------------------------------------------------------------
+// The card faces are made from templates. In a template 'S' is the symbol of
+// the suit and 'R' is the label of the rank. The top and bottom rows are
+// always the border so a template only has the seven rows between them.
+// ----------------------------------------------------------------------------
+
+/// @brief The seven middle rows of a card graphic.
+using CardTemplate = std::array<std::string_view, graphic_rows - 2>;
+
+// The border at the top and bottom of every card.
+inline constexpr std::string_view card_border = "+-----------+";
+
+// The symbols of the suits in UTF-8. Each one is 3 bytes but one character.
+inline constexpr std::array<std::string_view, 4> suit_symbols = {
+   "\xe2\x99\xa0", "\xe2\x99\xa5", "\xe2\x99\xa3", "\xe2\x99\xa6"};
+
+// The labels of the ranks.
+inline constexpr std::array<std::string_view, 13> rank_labels = {
+   "A", "2", "3", "4", "5", "6", "7", "8", "9", "10", "J", "Q", "K"};
+
+// The ace through ten look the same in every suit.
+inline constexpr std::array<CardTemplate, 10> pip_templates = {{
+   // A
+   {{"|R          |",
+     "|S          |",
+     "|           |",
+     "|     S     |",
+     "|           |",
+     "|          S|",
+     "|          R|"}},
+   // 2
+   {{"|R          |",
+     "|S    S     |",
+     "|           |",
+     "|           |",
+     "|           |",
+     "|     S    S|",
+     "|          R|"}},
+   // 3
+   {{"|R          |",
+     "|S    S     |",
+     "|           |",
+     "|     S     |",
+     "|           |",
+     "|     S    S|",
+     "|          R|"}},
+   // 4
+   {{"|R          |",
+     "|S  S   S   |",
+     "|           |",
+     "|           |",
+     "|           |",
+     "|   S   S  S|",
+     "|          R|"}},
+   // 5
+   {{"|R          |",
+     "|S  S   S   |",
+     "|           |",
+     "|     S     |",
+     "|           |",
+     "|   S   S  S|",
+     "|          R|"}},
+   // 6
+   {{"|R          |",
+     "|S  S   S   |",
+     "|           |",
+     "|   S   S   |",
+     "|           |",
+     "|   S   S  S|",
+     "|          R|"}},
+   // 7
+   {{"|R          |",
+     "|S  S   S   |",
+     "|     S     |",
+     "|   S   S   |",
+     "|           |",
+     "|   S   S  S|",
+     "|          R|"}},
+   // 8
+   {{"|R          |",
+     "|S  S   S   |",
+     "|     S     |",
+     "|   S   S   |",
+     "|     S     |",
+     "|   S   S  S|",
+     "|          R|"}},
+   // 9
+   {{"|R  S   S   |",
+     "|S          |",
+     "|   S   S   |",
+     "|     S     |",
+     "|   S   S   |",
+     "|          S|",
+     "|   S   S  R|"}},
+   // 10
+   {{"|R S   S   |",
+     "|S    S     |",
+     "|   S   S   |",
+     "|           |",
+     "|   S   S   |",
+     "|     S    S|",
+     "|   S   S R|"}}
+}};
+
+// The jack, queen and king are drawn a little differently in every suit.
+inline constexpr std::array<std::array<CardTemplate, 3>, 4> face_templates = {{
+   {{
+      // J spade
+      {{"|R S RRR R  |",
+        "|S   RRO R  |",
+        "|   R   RR  |",
+        "|  R  R  R  |",
+        "|  RR   R   |",
+        "|  R ORR   S|",
+        "|  R RRR S R|"}},
+      // Q spade
+      {{"|R S RRR    |",
+        "|S R ROO    |",
+        "|   R   R   |",
+        "|  R  R  R  |",
+        "|   R R R   |",
+        "|    OOR R S|",
+        "|    RRR S R|"}},
+      // K spade
+      {{"|R S RRR R  |",
+        "|S   ROO R  |",
+        "|   R   R   |",
+        "|  R R R R  |",
+        "|   R R R   |",
+        "|  R OOR   S|",
+        "|  R RRR S R|"}}
+   }},
+   {{
+      // J heart
+      {{"|R S RRR R  |",
+        "|S R ORR R  |",
+        "|   R   RR  |",
+        "|  R  R  R  |",
+        "|  RR   R   |",
+        "|  R RRO R S|",
+        "|  R RRR S R|"}},
+      // Q heart
+      {{"|R S RRR    |",
+        "|S   OOR R  |",
+        "|   R   R   |",
+        "|  R  R  R  |",
+        "|   R R R   |",
+        "|  R ROO   S|",
+        "|    RRR S R|"}},
+      // K heart
+      {{"|R S RRR<R  |",
+        "|S   OOR R  |",
+        "|   R   R   |",
+        "|  R R R R  |",
+        "|   R R R   |",
+        "|  R ROO   S|",
+        "|  R>RRR S R|"}}
+   }},
+   {{
+      // J club
+      {{"|R S RRR R  |",
+        "|S   ROO R  |",
+        "|   R   RR  |",
+        "|  R  R  R  |",
+        "|  RR   R   |",
+        "|  R OOR   S|",
+        "|  R RRR S R|"}},
+      // Q club
+      {{"|R S RRR    |",
+        "|S R OOR    |",
+        "|   R   R   |",
+        "|  R  R  R  |",
+        "|   R R R   |",
+        "|    ROO R S|",
+        "|    RRR S R|"}},
+      // K club
+      {{"|R S RRR R  |",
+        "|S   OOR R  |",
+        "|   R   R   |",
+        "|  R R R R  |",
+        "|   R R R   |",
+        "|  R ROO   S|",
+        "|  R RRR S R|"}}
+   }},
+   {{
+      // J diamond
+      {{"|R S RRR R  |",
+        "|S   OOR R  |",
+        "|   R   RR  |",
+        "|  R  R  R  |",
+        "|  RR   R   |",
+        "|  R ROO   S|",
+        "|  R RRR S R|"}},
+      // Q diamond
+      {{"|R S RRR    |",
+        "|S R OOR    |",
+        "|   R   R   |",
+        "|  R  R  R  |",
+        "|   R R R   |",
+        "|    ROO R S|",
+        "|    RRR S R|"}},
+      // K diamond
+      {{"|R S RRR R  |",
+        "|S   ORR R  |",
+        "|   R   R   |",
+        "|  R R R R  |",
+        "|   R R R   |",
+        "|  R RRO   S|",
+        "|  R RRR S R|"}}
+   }}
+}};
+
+// The most bytes in a row of a card graphic. A row is 13 characters and the
+// suit symbols take 2 more bytes each.
+inline constexpr size_t graphic_row_bytes = 32;
+
+/// @brief The text of every card graphic, which the graphic rows look into.
+struct GraphicText
+{
+   std::array<std::array<std::array<char, graphic_row_bytes>, graphic_rows>, 
+              52> bytes{};
+   std::array<std::array<size_t, graphic_rows>, 52> sizes{};
+};
+
+/// @brief Fill in the text of every card graphic from the templates.
+/// @return The text.
+constexpr GraphicText MakeGraphicText()
+{
+   GraphicText out{};
+   for (size_t id = 0; id < 52; id++)
+   {
+      const size_t suit = id / 13;
+      const size_t rank = id % 13;
+      const CardTemplate& card = rank < 10 ? pip_templates[rank] 
+                                           : face_templates[suit][rank - 10];
+      for (size_t row = 0; row < graphic_rows; row++)
+      {
+         std::string_view source = card_border;
+         if (row != 0 && row != graphic_rows - 1)
+         {
+            source = card[row - 1];
+         }
+
+         // Copy the row putting in the suit and rank where they go.
+         size_t size = 0;
+         for (const char c : source)
+         {
+            std::string_view piece(&c, 1);
+            if (c == 'S')
+            {
+               piece = suit_symbols[suit];
+            }
+            else if (c == 'R')
+            {
+               piece = rank_labels[rank];
+            }
+            for (const char p : piece)
+            {
+               out.bytes[id][row][size++] = p;
+            }
+         }
+         out.sizes[id][row] = size;
+      }
+   }
+   return out;
+}
+
+// The text of every card graphic.
+inline constexpr GraphicText graphic_text = MakeGraphicText();
+
+/// @brief Make the graphic rows for every card.
+/// @return The graphics by suit index then rank minus one.
+constexpr std::array<std::array<CardArt, 13>, 4> MakeGraphics()
+{
+   std::array<std::array<CardArt, 13>, 4> out{};
+   for (size_t id = 0; id < 52; id++)
+   {
+      for (size_t row = 0; row < graphic_rows; row++)
+      {
+         out[id / 13][id % 13][row] = 
+            std::string_view(graphic_text.bytes[id][row].data(),
+                             graphic_text.sizes[id][row]);
+      }
+   }
+   return out;
+}
+
+// All of the graphics for the cards by suit index then rank minus one.
+inline constexpr std::array<std::array<CardArt, 13>, 4> graphics = 
+   MakeGraphics();
 } // CardGraphicsAndInfo
 // ----------------------------------------------------------------------------
 
-#endif
\ No newline at end of file
+#endif
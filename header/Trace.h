@@ -0,0 +1,270 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+// ----------------------------------------------------------------------------
+// Include block.
+// ----------------------------------------------------------------------------
+
+// Standard library include.
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+// ----------------------------------------------------------------------------
+
+#if defined(TRACING)
+
+// ----------------------------------------------------------------------------
+// Namespace block.
+// ----------------------------------------------------------------------------
+
+/// @brief Times hot parts of the games and keeps named counters, and writes
+///        them out as a Chrome trace ("chrome://tracing" or Perfetto).
+///
+///        This is off unless the program is built with "TRACING" defined
+///        (for example "g++ -DTRACING ..."). Without it none of this is
+///        compiled and "TRACE_SCOPE", "TRACE_COUNTER" and "TRACE_WRITE"
+///        expand to nothing, so the games have no extra instructions at all.
+///
+///        Each thread records into its own buffer without locking. The
+///        buffers are merged when the trace is written, so write it once the
+///        threads being traced are done or paused. A buffer stops recording
+///        at "max_events" so a long game cannot use up the memory.
+namespace Trace
+{
+   // -------------------------------------------------------------------------
+   // Type Declarations block.
+   // -------------------------------------------------------------------------
+
+   /// @brief One thing that was recorded.
+   struct Event
+   {
+      // The name. It must be a string literal so it lives forever.
+      const char* name;
+      // When it happened in nanoseconds since the program started.
+      int64_t     start;
+      // How long a timer took in nanoseconds, or a counter's value.
+      int64_t     value;
+      // True for a counter and false for a timer.
+      bool        counter;
+   };
+
+   /// @brief What one thread recorded.
+   struct ThreadBuffer
+   {
+      // The events in the order they ended.
+      std::vector<Event> events;
+      // The number the thread is shown with.
+      uint32_t           thread_id = 0;
+      // Events that did not fit.
+      uint64_t           dropped   = 0;
+   };
+   // -------------------------------------------------------------------------
+
+   // -------------------------------------------------------------------------
+   // Namespace Variables block.
+   // -------------------------------------------------------------------------
+
+   /// @brief The most events kept for each thread.
+   inline constexpr size_t max_events = size_t(1) << 20;
+
+   /// @brief When the program started. Times are counted from here.
+   inline const std::chrono::steady_clock::time_point epoch =
+      std::chrono::steady_clock::now();
+
+   /// @brief Every thread's buffer. They are kept after their thread ends
+   ///        so nothing is lost.
+   inline std::mutex                                 buffers_mutex;
+   inline std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+   /// @brief This thread's buffer, once it has recorded something.
+   inline thread_local ThreadBuffer* thread_buffer = nullptr;
+   // -------------------------------------------------------------------------
+
+   // -------------------------------------------------------------------------
+   // Namespace Functions block.
+   // -------------------------------------------------------------------------
+
+   /// @brief Get the time.
+   /// @return Nanoseconds since the program started.
+   inline int64_t Now()
+   {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+         std::chrono::steady_clock::now() - epoch).count();
+   }
+
+   /// @brief Get this thread's buffer, making it the first time.
+   /// @return The buffer.
+   inline ThreadBuffer& GetThreadBuffer()
+   {
+      if (thread_buffer == nullptr)
+      {
+         std::lock_guard<std::mutex> lock(buffers_mutex);
+         buffers.push_back(std::make_unique<ThreadBuffer>());
+         thread_buffer            = buffers.back().get();
+         thread_buffer->thread_id = static_cast<uint32_t>(buffers.size());
+      }
+      return *thread_buffer;
+   }
+
+   /// @brief Record an event on this thread.
+   /// @param event The event.
+   inline void Record(const Event& event)
+   {
+      ThreadBuffer& buffer = GetThreadBuffer();
+      if (buffer.events.size() < max_events)
+      {
+         buffer.events.push_back(event);
+      }
+      else
+      {
+         buffer.dropped++;
+      }
+   }
+
+   /// @brief Record a counter's value now.
+   /// @param name The name of the counter. It must be a string literal.
+   /// @param value The value.
+   inline void Count(const char* name, const int64_t value)
+   {
+      Record(Event{name, Now(), value, true});
+   }
+
+   /// @brief Throw away everything recorded so far.
+   inline void Clear()
+   {
+      std::lock_guard<std::mutex> lock(buffers_mutex);
+      for (auto& buffer : buffers)
+      {
+         buffer->events.clear();
+         buffer->dropped = 0;
+      }
+   }
+
+   /// @brief Write a name as a JSON string.
+   /// @param out Where to write it.
+   /// @param name The name.
+   inline void WriteName(std::ostream& out, const char* name)
+   {
+      out << '"';
+      for (const char* c = name; *c != '\0'; c++)
+      {
+         if (*c == '"' || *c == '\\')
+         {
+            out << '\\';
+         }
+         out << *c;
+      }
+      out << '"';
+   }
+
+   /// @brief Write everything recorded as a Chrome trace. Timers are
+   ///        complete ("X") events and counters are counter ("C") events.
+   ///        Times are in microseconds.
+   /// @param out Where to write it.
+   inline void WriteChromeJson(std::ostream& out)
+   {
+      std::lock_guard<std::mutex> lock(buffers_mutex);
+      out << "{\"traceEvents\":[";
+      bool first = true;
+      for (const auto& buffer : buffers)
+      {
+         for (const Event& event : buffer->events)
+         {
+            out << (first ? "\n" : ",\n") << "{\"name\":";
+            WriteName(out, event.name);
+            out << ",\"pid\":1,\"tid\":" << buffer->thread_id
+                << ",\"ts\":" << event.start / 1000 << '.'
+                << event.start / 100 % 10 << event.start / 10 % 10
+                << event.start % 10;
+            if (event.counter)
+            {
+               out << ",\"ph\":\"C\",\"args\":{\"value\":" << event.value
+                   << "}}";
+            }
+            else
+            {
+               out << ",\"ph\":\"X\",\"dur\":" << event.value / 1000 << '.'
+                   << event.value / 100 % 10 << event.value / 10 % 10
+                   << event.value % 10 << "}";
+            }
+            first = false;
+         }
+      }
+      out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+   }
+
+   /// @brief Write everything recorded as a Chrome trace to a file.
+   /// @param path The file.
+   /// @return Whether it was written.
+   inline bool WriteChromeJson(const std::string& path)
+   {
+      std::ofstream file(path);
+      WriteChromeJson(file);
+      return static_cast<bool>(file);
+   }
+   // -------------------------------------------------------------------------
+
+   // -------------------------------------------------------------------------
+   // Class block.
+   // -------------------------------------------------------------------------
+
+   /// @brief Times the rest of the scope it is made in. Use "TRACE_SCOPE"
+   ///        so it goes away when tracing is off.
+   class Timer
+   {
+      private:
+         // The name of what is timed.
+         const char* name;
+         // When the timer started.
+         int64_t     start;
+
+      public:
+         /// @brief Start timing.
+         /// @param name_input The name. It must be a string literal.
+         explicit Timer(const char* name_input):
+            name(name_input), start(Now())
+         {}
+
+         /// @brief Record how long it took.
+         ~Timer() { Record(Event{name, start, Now() - start, false}); }
+
+         Timer(const Timer&) = delete;
+         Timer& operator=(const Timer&) = delete;
+   }; // Timer
+   // -------------------------------------------------------------------------
+} // Trace
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Macros block.
+// ----------------------------------------------------------------------------
+
+/// @brief Time the rest of the scope.
+/// @param name The name shown in the trace. It must be a string literal.
+#define TRACE_SCOPE(name) Trace::Timer trace_timer(name)
+
+/// @brief Record the value of a counter.
+/// @param name The name of the counter. It must be a string literal.
+/// @param value The value.
+#define TRACE_COUNTER(name, value) \
+   Trace::Count(name, static_cast<int64_t>(value))
+
+/// @brief Write the trace to a file.
+/// @param path The file.
+#define TRACE_WRITE(path) Trace::WriteChromeJson(std::string(path))
+// ----------------------------------------------------------------------------
+
+#else
+
+#define TRACE_SCOPE(name)
+#define TRACE_COUNTER(name, value)
+#define TRACE_WRITE(path)
+
+#endif
+
+#endif
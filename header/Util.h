@@ -8,6 +8,7 @@
 // Standard library include.
 #include <iostream>
 #include <string>
+#include <string_view>
 // ----------------------------------------------------------------------------
 
 // ----------------------------------------------------------------------------
@@ -47,12 +48,13 @@ namespace Util
    /// @param original_string The original string with maybe UTF8
    ///                        characters.
    /// @param sub_str_length The length of the string.
-   /// @return The new string the computer can interpret.
-   std::string UTF8SubStr(const std::string original_string, 
-                          const int         sub_str_length)
+   /// @return The new string the computer can interpret. It looks into the
+   ///         original string.
+   std::string_view UTF8SubStr(const std::string_view original_string, 
+                               const int              sub_str_length)
    {
       int len = 0, byteIndex = 0;
-      const char* aStr = original_string.c_str();
+      const char* aStr = original_string.data();
       size_t origSize = original_string.size();
 
       for (byteIndex = 0; byteIndex < origSize; byteIndex++)
@@ -6,17 +6,17 @@
 // ----------------------------------------------------------------------------
 
 // Standard Library includes.
-#include <random>
 #include <algorithm>
 
 // Utility File includes.
-// This is my own home grown utilities for this specific project.
-#include "Ansi.h"
+// This draws the screen and only sends what changed.
+#include "DiffRenderer.hpp"
+// Timers for the hot parts when built with "TRACING".
+#include "Trace.h"
 
 // Regular File includes.
-// This is the header file for the implementation of a standard deck
-// of cards class.
-#include "StandardDeck.hpp"
+// This is the header file for the rules of war without the input and output.
+#include "WarEngine.hpp"
 // ----------------------------------------------------------------------------
 
 // ----------------------------------------------------------------------------
@@ -24,36 +24,24 @@
 // ----------------------------------------------------------------------------
 
 /// @brief A class for playing the card game war.
-class War
+class War: public WarEngine
 {
    private:
       // ----------------------------------------------------------------------
       // Private Variables block.
       // ----------------------------------------------------------------------
 
-      // The hands for the game. Second is the player and 
-      // first is the computer.
-      mutable SplitDeck<StandardPlayingCard> hands;
       // The type of game they will play. 'start' is manual.
       // 'auto' is an automatic game.
       mutable std::string game = "";
+      // Draws the cards. It keeps the last screen to only send changes.
+      DiffRenderer        screen;
       // ----------------------------------------------------------------------
 
       // ----------------------------------------------------------------------
       // Private Functions block.
       // ----------------------------------------------------------------------
 
-      /// @brief Deal all the cards.
-      void Deal()
-      {
-         // Get a deck of cards.
-         StandardDeck<StandardPlayingCard> deck;
-         // Shuffle the deck.
-         deck.RandomizeDeck();
-         // Split it into the hands.
-         hands = deck.Split(26);
-      }
-
       /// @brief Introduce the game.
       /// @return The type of game they will play. 'start' is manual.
       ///         'auto' is an automatic game.
@@ -71,203 +59,126 @@ class War
          return input;
       }
 
-      /// @brief Move the cards from the loser to the winner.
-      /// @param cards_input The cards that are going to the loser.
-      /// @param winner The winner's hand.
-      void MoveCards(Pile<StandardPlayingCard> &cards_input,
-                     Pile<StandardPlayingCard> &winner)
-      {
-         // Randomize how the cards got into the hand.
-         std::random_device rd;
-         std::mt19937 rng(rd());
-         std::shuffle(cards_input.begin(), cards_input.end(), rng);
-         
-         // Add the cards to the hand.
-         auto iter = winner.begin();
-         while (!cards_input.empty())
-         {
-            iter = winner.insert(iter,std::move(cards_input.back()));
-            cards_input.pop_back();
-         }
-      } // MoveCards
-
-      /// @brief If a war occurs 
-      /// @param previous_cards 
-      void GoToWar(Pile<StandardPlayingCard> &previous_cards)
+      /// @brief Add one row of the backs of the amount of cards we need.
+      /// @param frame The frame to add them to.
+      /// @param row The row of the card graphics.
+      /// @param amount The amount of backs of cards we need.
+      static void AddBacks(FrameBuffer& frame,
+                           const size_t row,
+                           const size_t amount)
       {
-         for (int i = 0; i < 3; i++)
+         // Get the backs but only the first 5 columns.
+         for (size_t j = 0; j < amount; j++)
          {
-            if (hands.first.size() > 1 &&
-                hands.second.size() > 1)
-            {
-               previous_cards.push_back(std::move(hands.first.back()));
-               previous_cards.push_back(std::move(hands.second.back()));
-               hands.first.pop_back();
-               hands.second.pop_back();
-            }
+            frame.Append(CardGraphicsAndInfo::back[row].substr(5));
          }
-      } // GoToWar
+      }
 
-      /// @brief Get the backs of the amount of cards we need.
-      /// @param amount The amount of backs of cards we need.
-      /// @return The backs of cards graphics.
-      std::vector<std::string> MakeBacks(const size_t amount)
+      /// @brief Add one hand's card to the frame, with the backs of the
+      ///        cards put down for a war next to it.
+      /// @param frame The frame to add it to.
+      /// @param card The graphic of the card on top of the hand.
+      /// @param backs The amount of backs to show.
+      /// @param label What to call the hand.
+      /// @param size The amount of cards in the hand.
+      static void AddHand(FrameBuffer&                       frame,
+                          const CardGraphicsAndInfo::CardArt& card,
+                          const size_t                       backs,
+                          const std::string_view             label,
+                          const size_t                       size)
       {
-         // Initialize the output variable.
-         std::vector<std::string> out = {};
-         // We will be adding to a line so initialize it here.
-         std::string line("");
-         // Get the backs but only the first 5 columns.
-         for (size_t i = 0; i < CardGraphicsAndInfo::back.size(); i++)
+         for (size_t i = 0; i < card.size(); i++)
          {
-            for (size_t j = 0; j < amount; j++)
+            frame.Append(card[i]);
+            AddBacks(frame, i, backs);
+            // Also output how many cards they have left.
+            if (i == card.size() - 1)
             {
-               line += CardGraphicsAndInfo::back[i].substr(5);
+               frame.Append(label);
+               frame.AppendNumber(size);
             }
-            out.push_back(line);
-            line.clear();
+            frame.EndRow();
          }
-
-         return out;
       }
 
-      /// @brief Output the graphics and also play the game.
+      /// @brief Output the graphics and also play the game. Only what
+      ///        changed since the last time is written.
       /// @param tie_input Tells if we tied or not and need to output
       ///                  different graphics.
       void OutputGraphics(const bool tie_input)
       {
-         // Clear the screen and go to the corner.
-         std::cout << Ansi_t::clrscr();
-         std::cout << Ansi_t::gotoRC(0,0);
+         ALLOCATION_SCOPE(frame);
 
-         // Get the top card on both players hands.
-         std::vector<std::string> opp_card = hands.first.back()->GetGraphic();
-         std::vector<std::string> pla_card = hands.second.back()->GetGraphic();
+         // Two cards and a blank line.
+         FrameBuffer& frame = screen.Begin(
+            2 * CardGraphicsAndInfo::graphic_rows + 1, 64);
 
-         // Did we tie before this?
-         if (!tie_input)
+         // Did we tie before this? If so we are going to war and need to
+         // show the backs of the cards each player puts down.
+         size_t backs = 0;
+         if (tie_input)
          {
-            // No. Display the opponents card.
-            for (size_t i = 0; i < opp_card.size() - 1; i++)
-            {
-               std::cout << opp_card[i] << "\n";
-            }
-            // Also output how many cards they have left.
-            std::cout << opp_card.back() << "   Opponent's Deck: " 
-                      << hands.first.size() << "\n";
-            // Display the player's card.
-            for (size_t i = 0; i < pla_card.size() - 1; i++)
-            {
-               std::cout << pla_card[i] << "\n";
-            }
-            // Display how many cards the user has left.
-            std::cout << pla_card.back() << "   Player's Deck: " 
-                      << hands.second.size() << "\n\n";
-         }
-         else
-         {
-            // Yes. We are going to war and need to display more stuff.
-
-            // Get the amount of cards in the computer's hand.
-            size_t amount = hands.first.size();
-            // If the amount of cards in the player's hand is less than
+            // At most we need 3 cards but if either hand has less then we
             // use that amount.
-            if (amount > hands.second.size())
-            {
-               amount = hands.second.size();
-            }
+            backs = std::min<size_t>({3, hands.first.Size(),
+                                      hands.second.Size()});
+         }
 
-            // We need to get the backs of some cards.
-            // Initialize the string vector here.
-            std::vector<std::string> backs = {};
-            // At most we need 3 cards but if the amount is less then
-            // we use that.
-            if (amount >= 3)
-            {
-               backs = MakeBacks(3);
-            }
-            else 
-            {
-               backs = MakeBacks(amount);
-            }
+         // Display the opponents card then the player's card.
+         AddHand(frame, hands.first.Top().GetGraphic(), backs,
+                 "   Opponent's Deck: ", hands.first.Size());
+         AddHand(frame, hands.second.Top().GetGraphic(), backs,
+                 "   Player's Deck: ", hands.second.Size());
+         frame.EndRow();
 
-            // Display the opponents card.
-            for (size_t i = 0; i < opp_card.size() - 1; i++)
-            {
-               std::cout << opp_card[i] << backs[i] << "\n";
-            }
-            // Also output how many cards they have left.
-            std::cout << opp_card.back() << backs.back() 
-                      << "   Opponent's Deck: " 
-                      << hands.first.size() << "\n";
-            // Display the player's card.
-            for (size_t i = 0; i < pla_card.size() - 1; i++)
-            {
-               std::cout << pla_card[i] << backs[i] << "\n";
-            }
-            // Display how many cards the user has left.
-            std::cout << pla_card.back() << backs.back() 
-                      << "   Player's Deck: " 
-                      << hands.second.size() << "\n\n";
-         }
+         screen.Present();
       } // OutputGraphics
 
       /// @brief Play a round of war.
       void PlayARound()
       {
+         TRACE_SCOPE("War::PlayARound");
+
          // Initialize the "tie" variable. 
          bool tie = false;
-         // The cards that have been played.
-         Pile<StandardPlayingCard> stack;
+         // Start with no cards played.
+         played.clear();
          // Loop until tie is broken.
          do
          {
             // This outputs the graphics and show the user what is happening.
             OutputGraphics(tie);
 
-            // Determine if the player won. 
-            if ((hands.first.back()->GetRank() < 
-                    hands.second.back()->GetRank() &&
-                 hands.first.back()->GetRank() != 1) ||
-                (hands.second.back()->GetRank() == 1 && 
-                 hands.first.back()->GetRank() != 1))
+            // Determine who won.
+            WarRoundWinner winner = CompareCards(hands.first.Top(),
+                                                 hands.second.Top());
+            // Either way the top cards are played.
+            PlayTopCards(played);
+
+            if (winner == WarRoundWinner::player)
             {
-               // If they did then move the cards to the stack.
+               // If they did then move the cards to the players hand.
                std::cout << "You won this round!\n\n";
-               stack.push_back(std::move(hands.first.back()));
-               stack.push_back(std::move(hands.second.back()));
-               // Pop the memory slots.
-               hands.first.pop_back();
-               hands.second.pop_back();
-               // Move the cards to the players hand.
-               MoveCards(stack,hands.second);
+               MoveCards(played,hands.second);
                // There was no tie and we can leave the loop.
                tie = false;
                break;
             }
-            else if ((hands.first.back()->GetRank() > 
-                        hands.second.back()->GetRank()) || 
-                     (hands.first.back()->GetRank() == 1 && 
-                      hands.second.back()->GetRank() != 1))
+            else if (winner == WarRoundWinner::opponent)
             {
-               // Else the computer won. Move the cards to the stack.
+               // Else the computer won. Move the cards to the computer hand.
                std::cout << "You opponent won this round!\n\n";
-               stack.push_back(std::move(hands.first.back()));
-               stack.push_back(std::move(hands.second.back()));
-               // Pop the memory slots.
-               hands.first.pop_back();
-               hands.second.pop_back();
-               // Move the cards to the computer hand.
-               MoveCards(stack,hands.first);
+               MoveCards(played,hands.first);
                // There was no tie and we can leave the loop.
                tie = false;
                break;
             }
             else
             {
-               // There was a tie. I don't know if this can happen.
-               if (hands.first.size() == 0 ||
-                   hands.second.size() == 0)
+               // There was a tie. If someone has nothing left to flip the
+               // game is over.
+               if (hands.first.Size() == 0 ||
+                   hands.second.Size() == 0)
                {
                   std::cout << "The game ended on a WAR!" << std::endl;
                   tie = false;
@@ -282,14 +193,8 @@ class War
                   std::cin >> in;
                   std::cout << std::endl << std::endl;
                }
-               // Push back the cards to the stack for later.
-               stack.push_back(std::move(hands.first.back()));
-               stack.push_back(std::move(hands.second.back()));
-               // Pop the memory slots.
-               hands.first.pop_back();
-               hands.second.pop_back();
                // Go to war and say it was a tie so they keep going.
-               GoToWar(stack);
+               GoToWar(played);
                tie = true;
             }
          } 
@@ -302,8 +207,8 @@ class War
          // Initialize the "users_input" variable.
          std::string user_input = "";
          // While they both have cards keep playing.
-         while (hands.first.size() > 0 &&
-                hands.second.size() > 0 && 
+         while (hands.first.Size() > 0 &&
+                hands.second.Size() > 0 && 
                 (user_input != "stop" &&
                  user_input != "s"))
          {
@@ -336,10 +241,12 @@ class War
       void PlayAAutoGame()
       {
          size_t count = 0;
-         // Stop it at some point so we don't go infinite.
-         // (Don't know if it is possible to go infinite but maybe.)
-         while (hands.first.size() > 0 &&
-                hands.second.size() > 0 &&
+         // Stop it at some point so we don't go infinite. Won cards go back
+         // shuffled here so a true loop can't happen, but a game can still
+         // run a very long time. See "WarEngine::PlayAGame" for the rule
+         // where loops do happen and are found.
+         while (hands.first.Size() > 0 &&
+                hands.second.Size() > 0 &&
                 count < 1000)
          {
             PlayARound();
@@ -349,6 +256,14 @@ class War
       // ----------------------------------------------------------------------
    
    public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      /// @brief The standard constructor. Every game is different.
+      War(): WarEngine(Random::FreshSeed()) {}
+      // ----------------------------------------------------------------------
+
       // ----------------------------------------------------------------------
       // Public Functions block.
       // ----------------------------------------------------------------------
@@ -371,12 +286,12 @@ class War
             PlayAAutoGame();
          }
 
-         if (hands.first.size() == 0)
+         if (hands.first.Size() == 0)
          {
             std::cout << "YOU WON!!" << std::endl;
          }
 
-         if (hands.second.size() == 0)
+         if (hands.second.Size() == 0)
          {
             std::cout << "YOU LOST!!" << std::endl;
          }
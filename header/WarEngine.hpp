@@ -0,0 +1,442 @@
+#ifndef WARENGINE_HPP
+#define WARENGINE_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <algorithm>
+#include <cstdint>
+
+// Regular File includes.
+// This is the header file for the ring of slots each hand is kept in.
+#include "CircularHand.hpp"
+// This is the header file for the implementation of a standard deck
+// of cards class.
+#include "StandardDeck.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Type Declarations block.
+// ----------------------------------------------------------------------------
+
+/// @brief One player's hand.
+using WarHand = CircularHand<PackedStandardPlayingCard>;
+/// @brief Both hands. Second is the player and first is the computer.
+using WarHands = std::pair<WarHand, WarHand>;
+
+/// @brief Who won a single comparison of the top cards.
+enum class WarRoundWinner
+{
+   player,
+   opponent,
+   tie
+};
+
+/// @brief How a game of war finished.
+enum class WarOutcome
+{
+   // The opponent ran out of cards.
+   player_won,
+   // The player ran out of cards.
+   opponent_won,
+   // Someone ran out of cards in the middle of a war.
+   ended_on_war,
+   // The hands came back to a position they were already in, so the game
+   // would go on forever.
+   cycling,
+   // We hit the round limit before anyone ran out.
+   capped
+};
+
+/// @brief The amount of ways a game of war can finish.
+inline constexpr size_t war_outcome_count = 5;
+
+/// @brief The order won cards go on the bottom of the winner's hand.
+enum class WarReturnOrder
+{
+   // In a random order. This is how people actually pick the cards up.
+   shuffled,
+   // In the order they were played. The first card played ends up on the
+   // very bottom. With this order a game is fixed once it is dealt.
+   played
+};
+
+/// @brief The rules that can be changed for a headless game.
+struct WarRules
+{
+   // The order won cards go back into a hand.
+   WarReturnOrder return_order  = WarReturnOrder::shuffled;
+   // Whether to look for the hands repeating. This only does anything with
+   // the "played" return order. Shuffled returns never truly repeat.
+   bool           detect_cycles = false;
+};
+
+/// @brief Everything we want to know about one headless game.
+struct WarResult
+{
+   // How the game finished.
+   WarOutcome outcome      = WarOutcome::capped;
+   // The amount of rounds played. A round ends when someone takes the cards.
+   size_t     rounds       = 0;
+   // The amount of ties that sent us to war.
+   size_t     wars         = 0;
+   // If the game was cycling, the amount of rounds in one loop.
+   size_t     cycle_length = 0;
+};
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief The rules of war without any input or output. Games are played
+///        from a seed so the same seed always plays the same game.
+class WarEngine
+{
+   protected:
+      // ----------------------------------------------------------------------
+      // Protected Variables block.
+      // ----------------------------------------------------------------------
+
+      // The hands for the game. Second is the player and
+      // first is the computer.
+      mutable WarHands hands;
+      // The cards played in the current round. Kept here so the memory is
+      // reused from round to round.
+      Pile<PackedStandardPlayingCard> played;
+      // The generator used for dealing and for the order won cards go back
+      // into a hand.
+      Random::Xoshiro256 rng;
+      // The rules for headless games.
+      WarRules           rules;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Protected Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Compare the top cards. Aces are high.
+      /// @param opponent The opponent's top card.
+      /// @param player The player's top card.
+      /// @return Who won the comparison.
+      static WarRoundWinner CompareCards(
+         const PackedStandardPlayingCard& opponent,
+         const PackedStandardPlayingCard& player)
+      {
+         if ((opponent.GetRank() < player.GetRank() &&
+              opponent.GetRank() != 1) ||
+             (player.GetRank() == 1 && opponent.GetRank() != 1))
+         {
+            return WarRoundWinner::player;
+         }
+         else if (opponent.GetRank() > player.GetRank() ||
+                  (opponent.GetRank() == 1 && player.GetRank() != 1))
+         {
+            return WarRoundWinner::opponent;
+         }
+
+         return WarRoundWinner::tie;
+      }
+
+      /// @brief Deal all the cards.
+      void Deal()
+      {
+         ALLOCATION_SCOPE(deal);
+
+         // Get a deck of cards.
+         StandardDeck<PackedStandardPlayingCard> deck;
+         // Shuffle the deck.
+         deck.RandomizeDeck(rng);
+         // Split it into the hands. The top of the deck is the back.
+         SplitDeck<PackedStandardPlayingCard> halves = deck.Split(26);
+         hands.first.Assign(halves.first.begin(), halves.first.end());
+         hands.second.Assign(halves.second.begin(), halves.second.end());
+      }
+
+      /// @brief Move the cards from the loser to the winner.
+      /// @param cards_input The cards that are going to the winner.
+      /// @param winner The winner's hand.
+      void MoveCards(Pile<PackedStandardPlayingCard> &cards_input,
+                     WarHand                         &winner)
+      {
+         ALLOCATION_SCOPE(move);
+
+         // Randomize how the cards got into the hand.
+         if (rules.return_order == WarReturnOrder::shuffled)
+         {
+            Random::Shuffle(cards_input.begin(), cards_input.end(), rng);
+         }
+
+         // Add the cards to the bottom of the hand. The first card ends up
+         // on the very bottom.
+         while (!cards_input.empty())
+         {
+            winner.PushBottom(cards_input.back());
+            cards_input.pop_back();
+         }
+      } // MoveCards
+
+      /// @brief If a war occurs each player puts down up to three cards
+      ///        face down. They always keep one card to flip.
+      /// @param previous_cards The cards already played this round.
+      void GoToWar(Pile<PackedStandardPlayingCard> &previous_cards)
+      {
+         for (int i = 0; i < 3; i++)
+         {
+            if (hands.first.Size() > 1 &&
+                hands.second.Size() > 1)
+            {
+               previous_cards.push_back(hands.first.PopTop());
+               previous_cards.push_back(hands.second.PopTop());
+            }
+         }
+      } // GoToWar
+
+      /// @brief Hash both hands. Equal positions always hash the same.
+      /// @return The hash.
+      uint64_t HashHands() const
+      {
+         // FNV-1a over the cards from the bottom up, with the size of the
+         // first hand mixed in so the split point matters.
+         uint64_t hash = 0xcbf29ce484222325ULL ^ hands.first.Size();
+         for (size_t i = 0; i < hands.first.Size(); i++)
+         {
+            hash = (hash ^ hands.first.At(i).GetId()) * 0x100000001b3ULL;
+         }
+         for (size_t i = 0; i < hands.second.Size(); i++)
+         {
+            hash = (hash ^ hands.second.At(i).GetId()) * 0x100000001b3ULL;
+         }
+         return hash;
+      }
+
+      /// @brief Check if both hands are the same as a saved position.
+      /// @param saved The saved position.
+      /// @return True if every card is in the same place. False otherwise.
+      bool SameHands(const WarHands& saved) const
+      {
+         if (saved.first.Size() != hands.first.Size() ||
+             saved.second.Size() != hands.second.Size())
+         {
+            return false;
+         }
+         for (size_t i = 0; i < hands.first.Size(); i++)
+         {
+            if (!(saved.first.At(i) == hands.first.At(i)))
+            {
+               return false;
+            }
+         }
+         for (size_t i = 0; i < hands.second.Size(); i++)
+         {
+            if (!(saved.second.At(i) == hands.second.At(i)))
+            {
+               return false;
+            }
+         }
+         return true;
+      }
+
+      /// @brief Take both top cards and put them on the played stack.
+      /// @param stack The cards played this round.
+      void PlayTopCards(Pile<PackedStandardPlayingCard> &stack)
+      {
+         stack.push_back(hands.first.PopTop());
+         stack.push_back(hands.second.PopTop());
+      }
+
+      /// @brief Play out the hands as they are now without any output.
+      ///
+      ///        If the rules ask for it, this looks for the hands repeating
+      ///        with Brent's algorithm. One earlier position is kept and
+      ///        compared against after every round. It is replaced every
+      ///        time the amount of rounds since it was saved reaches the
+      ///        next power of two. Any loop is found within a couple of
+      ///        passes around it and only one extra copy of the hands is
+      ///        ever kept.
+      /// @param max_rounds Stop the game after this many rounds.
+      /// @return How the game went.
+      WarResult PlayDealt(const size_t max_rounds)
+      {
+         // Cycle detection only makes sense if nothing random happens after
+         // the deal.
+         const bool detect = rules.detect_cycles &&
+                             rules.return_order != WarReturnOrder::shuffled;
+         // The saved position and its hash.
+         WarHands saved      = hands;
+         uint64_t saved_hash = HashHands();
+         // The rounds we are allowed before replacing the saved position,
+         // and the rounds since we saved it.
+         size_t   power      = 1;
+         size_t   distance   = 0;
+
+         WarResult result;
+         while (!hands.first.Empty() &&
+                !hands.second.Empty() &&
+                result.rounds < max_rounds)
+         {
+            result.rounds++;
+            if (PlayARound(result.wars) == WarRoundWinner::tie)
+            {
+               result.outcome = WarOutcome::ended_on_war;
+               return result;
+            }
+
+            if (detect)
+            {
+               distance++;
+               // Only hash when the hand sizes match. Most rounds they do
+               // not.
+               if (saved.first.Size() == hands.first.Size() &&
+                   saved_hash == HashHands() &&
+                   SameHands(saved))
+               {
+                  result.outcome = WarOutcome::cycling;
+                  result.cycle_length = distance;
+                  return result;
+               }
+               if (distance == power)
+               {
+                  saved = hands;
+                  saved_hash = HashHands();
+                  power *= 2;
+                  distance = 0;
+               }
+            }
+         }
+
+         if (hands.first.Empty())
+         {
+            result.outcome = WarOutcome::player_won;
+         }
+         else if (hands.second.Empty())
+         {
+            result.outcome = WarOutcome::opponent_won;
+         }
+
+         return result;
+      } // PlayDealt
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Make an engine from a seed.
+      /// @param seed The seed for dealing and for returning won cards.
+      explicit WarEngine(const uint64_t seed = 0): rng(seed)
+      {
+         played.reserve(52);
+      }
+
+      /// @brief Make an engine from a seed with different rules.
+      /// @param seed The seed for dealing and for returning won cards.
+      /// @param rules_input The rules for headless games.
+      WarEngine(const uint64_t seed, const WarRules& rules_input):
+         rng(seed),
+         rules(rules_input)
+      {
+         played.reserve(52);
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Get block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Get the hands. Second is the player and first is the
+      ///        computer.
+      /// @return Return the reference to the hands.
+      const WarHands& GetHands() const
+      {
+         return hands;
+      }
+
+      /// @brief Get the rules for headless games.
+      /// @return The rules.
+      const WarRules& GetRules() const { return rules; }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Set block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Set the rules for headless games.
+      /// @param rules_input The rules.
+      void SetRules(const WarRules& rules_input) { rules = rules_input; }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Play a round without any output. A round keeps going to war
+      ///        until the tie is broken.
+      /// @param wars This is increased by the amount of wars in the round.
+      /// @return Who won the round. A tie means someone ran out of cards in
+      ///         the middle of a war.
+      WarRoundWinner PlayARound(size_t &wars)
+      {
+         // Start with no cards played.
+         played.clear();
+         // Loop until tie is broken.
+         while (true)
+         {
+            WarRoundWinner winner = CompareCards(hands.first.Top(),
+                                                 hands.second.Top());
+            PlayTopCards(played);
+
+            if (winner == WarRoundWinner::player)
+            {
+               MoveCards(played,hands.second);
+               return winner;
+            }
+            else if (winner == WarRoundWinner::opponent)
+            {
+               MoveCards(played,hands.first);
+               return winner;
+            }
+
+            // There was a tie so we go to war if we can.
+            wars++;
+            if (hands.first.Empty() || hands.second.Empty())
+            {
+               return WarRoundWinner::tie;
+            }
+            GoToWar(played);
+         }
+      } // PlayARound
+
+      /// @brief Deal and play an entire game without any output. See
+      ///        "PlayDealt" for how loops are found.
+      /// @param seed The seed for this game.
+      /// @param max_rounds Stop the game after this many rounds.
+      /// @return How the game went.
+      WarResult PlayAGame(const uint64_t seed,
+                          const size_t   max_rounds = 1000)
+      {
+         rng.Seed(seed);
+         Deal();
+         return PlayDealt(max_rounds);
+      } // PlayAGame
+
+      /// @brief Play an entire game from hands we were given, without any
+      ///        output. The generator is left as it is.
+      /// @param start The hands to start from. Second is the player and
+      ///              first is the computer.
+      /// @param max_rounds Stop the game after this many rounds.
+      /// @return How the game went.
+      WarResult PlayHands(const WarHands& start,
+                          const size_t    max_rounds = 1000)
+      {
+         hands = start;
+         return PlayDealt(max_rounds);
+      } // PlayHands
+      // ----------------------------------------------------------------------
+}; // WarEngine
+// ----------------------------------------------------------------------------
+
+#endif
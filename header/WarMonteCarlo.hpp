@@ -0,0 +1,236 @@
+#ifndef WARMONTECARLO_HPP
+#define WARMONTECARLO_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Utility File includes.
+// Seeds for each game.
+#include "Random.h"
+
+// Regular File includes.
+// This is the header file for the headless war rules.
+#include "WarEngine.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Type Declarations block.
+// ----------------------------------------------------------------------------
+
+/// @brief The totals for a batch of war games.
+struct WarStatistics
+{
+   // The amount of games played.
+   uint64_t              games        = 0;
+   // The amount of games that ended each way. Indexed by "WarOutcome".
+   uint64_t              outcomes[war_outcome_count] = {};
+   // The sum of the rounds and wars over all games.
+   uint64_t              total_rounds = 0;
+   uint64_t              total_wars   = 0;
+   // The amount of games that lasted each amount of rounds. The index is the
+   // amount of rounds.
+   std::vector<uint64_t> length_histogram;
+
+   /// @brief Add one game.
+   /// @param result The game to add.
+   void Add(const WarResult& result)
+   {
+      games++;
+      outcomes[static_cast<size_t>(result.outcome)]++;
+      total_rounds += result.rounds;
+      total_wars += result.wars;
+      if (result.rounds >= length_histogram.size())
+      {
+         length_histogram.resize(result.rounds + 1, 0);
+      }
+      length_histogram[result.rounds]++;
+   }
+
+   /// @brief Add the totals from another batch. Every total is a plain sum
+   ///        so the order we merge in does not matter.
+   /// @param other The other batch.
+   void Merge(const WarStatistics& other)
+   {
+      games += other.games;
+      for (size_t i = 0; i < war_outcome_count; i++)
+      {
+         outcomes[i] += other.outcomes[i];
+      }
+      total_rounds += other.total_rounds;
+      total_wars += other.total_wars;
+      if (other.length_histogram.size() > length_histogram.size())
+      {
+         length_histogram.resize(other.length_histogram.size(), 0);
+      }
+      for (size_t i = 0; i < other.length_histogram.size(); i++)
+      {
+         length_histogram[i] += other.length_histogram[i];
+      }
+   }
+
+   /// @brief Find the game length that a fraction of the games were at or
+   ///        under.
+   /// @param fraction The fraction 0 to 1. 0.5 is the median.
+   /// @return The amount of rounds.
+   size_t Percentile(const double fraction) const
+   {
+      const uint64_t wanted = static_cast<uint64_t>(fraction * games);
+      uint64_t seen = 0;
+      for (size_t i = 0; i < length_histogram.size(); i++)
+      {
+         seen += length_histogram[i];
+         if (seen > wanted || seen == games)
+         {
+            return i;
+         }
+      }
+      return 0;
+   }
+};
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief Plays a batch of headless war games on every core.
+///
+///        Game "i" is always seeded with "Random::StreamSeed(master_seed, i)"
+///        so it plays the same no matter which thread picks it up. Threads
+///        grab chunks of game indices from one atomic counter and keep their
+///        own totals, which are summed after the threads finish. Nothing is
+///        locked while the games run and the totals are exactly the same
+///        for any amount of threads.
+class WarMonteCarlo
+{
+   private:
+      // ----------------------------------------------------------------------
+      // Private Variables block.
+      // ----------------------------------------------------------------------
+
+      // The seed every game seed is made from.
+      uint64_t master_seed;
+      // Games are stopped after this many rounds.
+      size_t   max_rounds;
+      // The rules every game is played with.
+      WarRules rules;
+      // The amount of threads to use.
+      size_t   threads;
+      // How many games a thread takes from the counter at once.
+      static constexpr uint64_t chunk = 1024;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Private Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief The loop each thread runs. Keep taking chunks of games until
+      ///        there are none left.
+      /// @param next The index of the next game nobody has taken yet.
+      /// @param games The amount of games in the batch.
+      /// @param out Where this thread puts its totals.
+      void Worker(std::atomic<uint64_t>& next,
+                  const uint64_t         games,
+                  WarStatistics&         out) const
+      {
+         WarEngine     engine(0, rules);
+         WarStatistics local;
+         local.length_histogram.resize(max_rounds + 1, 0);
+
+         while (true)
+         {
+            uint64_t begin = next.fetch_add(chunk, std::memory_order_relaxed);
+            if (begin >= games)
+            {
+               break;
+            }
+            uint64_t end = std::min(begin + chunk, games);
+
+            for (uint64_t i = begin; i < end; i++)
+            {
+               local.Add(engine.PlayAGame(Random::StreamSeed(master_seed, i),
+                                          max_rounds));
+            }
+         }
+
+         // Only written once at the end so the threads never share a cache
+         // line while they are playing.
+         out = std::move(local);
+      }
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Set up a runner.
+      /// @param master_seed_input The seed for the whole batch.
+      /// @param max_rounds_input Games are stopped after this many rounds.
+      /// @param threads_input The amount of threads. 0 uses every core.
+      /// @param rules_input The rules every game is played with.
+      WarMonteCarlo(const uint64_t  master_seed_input,
+                    const size_t    max_rounds_input = 1000,
+                    const size_t    threads_input = 0,
+                    const WarRules& rules_input = WarRules()):
+         master_seed(master_seed_input),
+         max_rounds(max_rounds_input),
+         rules(rules_input),
+         threads(threads_input)
+      {
+         if (threads == 0)
+         {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+         }
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Play a batch of games.
+      /// @param games The amount of games to play.
+      /// @return The totals for all the games.
+      WarStatistics Run(const uint64_t games) const
+      {
+         std::atomic<uint64_t>      next(0);
+         std::vector<WarStatistics> results(threads);
+         std::vector<std::thread>   pool;
+         pool.reserve(threads);
+
+         for (size_t i = 0; i < threads; i++)
+         {
+            pool.emplace_back(&WarMonteCarlo::Worker, this,
+                              std::ref(next), games, std::ref(results[i]));
+         }
+         for (auto& thread : pool)
+         {
+            thread.join();
+         }
+
+         // Add up what each thread found.
+         WarStatistics out;
+         for (const auto& result : results)
+         {
+            out.Merge(result);
+         }
+         return out;
+      }
+
+      /// @brief Get the amount of threads this runner uses.
+      /// @return The amount of threads.
+      size_t GetThreads() const { return threads; }
+      // ----------------------------------------------------------------------
+}; // WarMonteCarlo
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,173 @@
+#ifndef WORKSTEALINGRANGE_HPP
+#define WORKSTEALINGRANGE_HPP
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <atomic>
+#include <cstdint>
+#include <memory>
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Class block.
+// ----------------------------------------------------------------------------
+
+/// @brief Hands out the indices 0 to count - 1 to a set of workers.
+///
+///        Each worker starts with an even slice and takes indices from the
+///        front of it. A worker whose slice is empty steals the back half of
+///        the biggest slice left. Each slice is one atomic word holding its
+///        begin and end, so taking and stealing are both a single compare
+///        and swap and nothing is ever locked. Jobs that take very different
+///        amounts of time still keep every worker busy until the end.
+class WorkStealingRange
+{
+   private:
+      // ----------------------------------------------------------------------
+      // Private Variables block.
+      // ----------------------------------------------------------------------
+
+      /// @brief One worker's slice. Begin is in the low 32 bits and end is
+      ///        in the high 32 bits. Padded so slices don't share a cache
+      ///        line.
+      struct alignas(64) Slice
+      {
+         std::atomic<uint64_t> bits{0};
+      };
+
+      // The slices, one per worker.
+      std::unique_ptr<Slice[]> slices;
+      // The amount of workers.
+      size_t                   workers;
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Private Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Put a begin and end in one word.
+      static uint64_t Pack(const uint64_t begin, const uint64_t end)
+      {
+         return begin | (end << 32);
+      }
+
+      /// @brief Get the begin from a word.
+      static uint64_t Begin(const uint64_t bits) { return bits & 0xffffffff; }
+
+      /// @brief Get the end from a word.
+      static uint64_t End(const uint64_t bits) { return bits >> 32; }
+
+      /// @brief Take the first index of a slice.
+      /// @param slice The slice.
+      /// @param index Where the index goes.
+      /// @return True if there was one to take.
+      static bool TakeFront(Slice& slice, uint64_t& index)
+      {
+         uint64_t bits = slice.bits.load(std::memory_order_relaxed);
+         while (Begin(bits) < End(bits))
+         {
+            if (slice.bits.compare_exchange_weak(
+                   bits, Pack(Begin(bits) + 1, End(bits)),
+                   std::memory_order_relaxed))
+            {
+               index = Begin(bits);
+               return true;
+            }
+         }
+         return false;
+      }
+
+      /// @brief Move the back half of the biggest slice to a worker.
+      /// @param worker The worker that ran out.
+      /// @return True if something was stolen. False if every slice is
+      ///         empty.
+      bool Steal(const size_t worker)
+      {
+         while (true)
+         {
+            // Find the biggest slice.
+            size_t   victim = workers;
+            uint64_t most   = 0;
+            uint64_t bits   = 0;
+            for (size_t i = 0; i < workers; i++)
+            {
+               uint64_t seen = slices[i].bits.load(std::memory_order_relaxed);
+               uint64_t left = End(seen) - Begin(seen);
+               if (Begin(seen) < End(seen) && left > most)
+               {
+                  victim = i;
+                  most = left;
+                  bits = seen;
+               }
+            }
+            if (victim == workers)
+            {
+               return false;
+            }
+
+            // Cut it in two. With one index left the thief takes it.
+            uint64_t middle = End(bits) - (most + 1) / 2;
+            if (slices[victim].bits.compare_exchange_strong(
+                   bits, Pack(Begin(bits), middle),
+                   std::memory_order_relaxed))
+            {
+               // Only this worker writes its own empty slice so a plain
+               // store is fine.
+               slices[worker].bits.store(Pack(middle, End(bits)),
+                                         std::memory_order_relaxed);
+               return true;
+            }
+            // Someone else got there first. Look again.
+         }
+      }
+      // ----------------------------------------------------------------------
+
+   public:
+      // ----------------------------------------------------------------------
+      // Constructors block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Split a range between workers.
+      /// @param count The amount of indices. Must be less than 2^32 so the
+      ///              end of the last slice fits in 32 bits.
+      /// @param workers_input The amount of workers.
+      WorkStealingRange(const uint64_t count, const size_t workers_input):
+         slices(new Slice[workers_input]),
+         workers(workers_input)
+      {
+         for (size_t i = 0; i < workers; i++)
+         {
+            slices[i].bits.store(Pack(count * i / workers,
+                                      count * (i + 1) / workers));
+         }
+      }
+      // ----------------------------------------------------------------------
+
+      // ----------------------------------------------------------------------
+      // Public Functions block.
+      // ----------------------------------------------------------------------
+
+      /// @brief Get the next index for a worker.
+      /// @param worker The worker, 0 to workers - 1.
+      /// @param index Where the index goes.
+      /// @return True if there was one. False once everything is handed out.
+      bool Next(const size_t worker, uint64_t& index)
+      {
+         do
+         {
+            if (TakeFront(slices[worker], index))
+            {
+               return true;
+            }
+         }
+         while (Steal(worker));
+         return false;
+      }
+      // ----------------------------------------------------------------------
+}; // WorkStealingRange
+// ----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+// ----------------------------------------------------------------------------
+// Include block.
+// ----------------------------------------------------------------------------
+
+// Standard library include.
+#include <iostream>
+#include <string>
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Print a pass or fail line for a check.
+/// @param name What we checked.
+/// @param passed Whether the check passed.
+inline void Check(const std::string name, const bool passed)
+{
+   if (passed)
+   {
+      std::cout << "PASS: " << name << ".\n";
+   }
+   else
+   {
+      std::cout << "FAIL: " << name << ".\n";
+   }
+}
+// ----------------------------------------------------------------------------
+
+#endif
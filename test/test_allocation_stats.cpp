@@ -0,0 +1,89 @@
+// Count every allocation so the scopes in the games have something to add up.
+#define ALLOCATION_STATS
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Regular File includes.
+// The shared pass or fail line for each check.
+#include "Check.h"
+// The counting itself.
+#include "../header/AllocationStats.h"
+// The games that are counted.
+#include "../header/Klondike.hpp"
+#include "../header/WarEngine.hpp"
+// ----------------------------------------------------------------------------
+
+using namespace Solitaire;
+using AllocationStats::Operation;
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief This program is for testing the allocation counting.
+/// @return The basic return for a successfully run program.
+int main()
+{
+   // A deck of packed cards is shuffled where it is.
+   StandardDeck<PackedStandardPlayingCard> deck;
+   AllocationStats::Reset();
+   for (size_t i = 0; i < 100; i++)
+   {
+      deck.RandomizeDeck();
+      deck.Cut(random_cut);
+   }
+   AllocationStats::Counts shuffle = AllocationStats::Get(Operation::shuffle);
+   Check("Shuffles are counted", shuffle.calls == 200);
+   Check("Shuffling packed cards allocates nothing",
+         shuffle.allocations == 0 && shuffle.peak_live_bytes == 0);
+
+   // The piles are kept inside the game.
+   Klondike klondike;
+   AllocationStats::Reset();
+   klondike.DealBySeed(1);
+   AllocationStats::Counts deal = AllocationStats::Get(Operation::deal);
+   Check("A deal is counted", deal.calls == 1);
+   Check("Dealing Klondike allocates nothing",
+         deal.allocations == 0 && deal.peak_live_bytes == 0);
+
+   // Scopes count everything under them, and the peak is over what was
+   // live when the scope started.
+   AllocationStats::Reset();
+   std::vector<char> kept(1000);
+   {
+      ALLOCATION_SCOPE(auto_move);
+      std::vector<char> outer(100);
+      {
+         ALLOCATION_SCOPE(move);
+         std::vector<char> inner(50);
+      }
+   }
+   AllocationStats::Counts outer = AllocationStats::Get(Operation::auto_move);
+   AllocationStats::Counts inner = AllocationStats::Get(Operation::move);
+   Check("An outer scope counts the inner one",
+         outer.allocations == 2 && outer.bytes == 150 &&
+         outer.peak_live_bytes == 150);
+   Check("An inner scope counts only itself",
+         inner.allocations == 1 && inner.bytes == 50 &&
+         inner.peak_live_bytes == 50);
+
+   // A game of war deals once and moves cards every round.
+   WarEngine engine;
+   AllocationStats::Reset();
+   const WarResult result = engine.PlayAGame(7);
+   Check("War counts its deal and moves",
+         AllocationStats::Get(Operation::deal).calls == 1 &&
+         AllocationStats::Get(Operation::move).calls >= result.rounds);
+
+   AllocationStats::Report(std::cout);
+
+   return 0;
+}
+// ----------------------------------------------------------------------------
@@ -0,0 +1,206 @@
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Regular File includes.
+// The shared pass or fail line for each check.
+#include "Check.h"
+// This is the header file for the "DiffRenderer" class.
+#include "../header/DiffRenderer.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief A pretend terminal that understands the few codes the renderer
+///        sends. Each cell holds one UTF-8 character.
+struct Terminal
+{
+   std::vector<std::vector<std::string>> cells;
+   size_t row    = 0;
+   size_t column = 0;
+
+   /// @brief Read a number from an escape code.
+   static size_t Number(const std::string_view bytes, size_t& i)
+   {
+      size_t number = 0;
+      while (i < bytes.size() && bytes[i] >= '0' && bytes[i] <= '9')
+      {
+         number = number * 10 + (bytes[i++] - '0');
+      }
+      return number;
+   }
+
+   /// @brief Put a character where the cursor is and move the cursor.
+   void Put(const std::string character)
+   {
+      if (cells.size() <= row)
+      {
+         cells.resize(row + 1);
+      }
+      if (cells[row].size() <= column)
+      {
+         cells[row].resize(column + 1, " ");
+      }
+      cells[row][column++] = character;
+   }
+
+   /// @brief Run the bytes sent to the terminal.
+   void Feed(const std::string_view bytes)
+   {
+      for (size_t i = 0; i < bytes.size();)
+      {
+         if (bytes[i] == '\x1b')
+         {
+            i += 2;
+            size_t first = Number(bytes, i);
+            size_t second = 0;
+            if (bytes[i] == ';')
+            {
+               i++;
+               second = Number(bytes, i);
+            }
+            char code = bytes[i++];
+            if (code == 'H')
+            {
+               row    = first == 0 ? 0 : first - 1;
+               column = second == 0 ? 0 : second - 1;
+            }
+            else if (code == 'J')
+            {
+               // 2J clears it all and J clears below the cursor.
+               if (first == 2)
+               {
+                  cells.clear();
+               }
+               else
+               {
+                  if (row < cells.size() && column < cells[row].size())
+                  {
+                     cells[row].resize(column);
+                  }
+                  if (row + 1 < cells.size())
+                  {
+                     cells.resize(row + 1);
+                  }
+               }
+            }
+            else if (code == 'K' && row < cells.size() &&
+                     column < cells[row].size())
+            {
+               cells[row].resize(column);
+            }
+         }
+         else if (bytes[i] == '\n')
+         {
+            row++;
+            column = 0;
+            i++;
+         }
+         else
+         {
+            size_t length = 1;
+            unsigned char lead = bytes[i];
+            length = lead < 0xc0 ? 1 : lead < 0xe0 ? 2 : lead < 0xf0 ? 3 : 4;
+            Put(std::string(bytes.substr(i, length)));
+            i += length;
+         }
+      }
+   }
+
+   /// @brief Get the screen as rows ending in new lines like a frame.
+   std::string Screen() const
+   {
+      std::string out;
+      for (const auto& line : cells)
+      {
+         std::string text;
+         for (const auto& cell : line)
+         {
+            text += cell;
+         }
+         out += text + "\n";
+      }
+      return Trim(out);
+   }
+
+   /// @brief Drop empty rows from the end since they look like nothing.
+   static std::string Trim(std::string frame)
+   {
+      while (frame.size() >= 2 && frame[frame.size() - 2] == '\n')
+      {
+         frame.pop_back();
+      }
+      return frame == "\n" ? "" : frame;
+   }
+};
+
+/// @brief Make a random frame. Rows come from a few choices so frames look
+///        alike, the way one game screen looks like the last one.
+std::string MakeFrame(std::mt19937& rng)
+{
+   static const std::string pieces[] = {"+-----------+", "|\xe2\x99\xa0    ",
+                                        "|\xe2\x99\xa5 10  |", "  ",
+                                        "             ", "|***@###@***|"};
+   std::string frame;
+   size_t rows = 10 + rng() % 20;
+   for (size_t r = 0; r < rows; r++)
+   {
+      size_t count = rng() % 8;
+      for (size_t c = 0; c < count; c++)
+      {
+         frame += pieces[(r + c + (rng() % 5 == 0 ? rng() : 0)) % 6];
+      }
+      frame += "\n";
+   }
+   return frame;
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief Draw random frames through the renderer into a pretend terminal
+///        and check the terminal always shows the frame.
+/// @return The basic return for a successfully run program.
+int main()
+{
+   std::mt19937 rng(7);
+   DiffRenderer renderer;
+   Terminal     terminal;
+   bool         matches = true;
+   size_t       sent    = 0;
+   size_t       full    = 0;
+   for (size_t i = 0; i < 500; i++)
+   {
+      std::string frame = MakeFrame(rng);
+      renderer.Begin(30, 64).Append(frame);
+      renderer.Render(50);
+      terminal.Feed(renderer.GetLastOutput());
+      matches = matches && terminal.Screen() == Terminal::Trim(frame);
+      sent += renderer.GetLastOutput().size();
+      full += frame.size();
+
+      // Pretend a prompt was printed under the frame.
+      terminal.Feed("Please enter your input.\n");
+   }
+   Check("the terminal shows every frame", matches);
+   Check("less is sent than drawing every frame", sent < full);
+
+   // A frame that does not fit the terminal is drawn in full.
+   renderer.Begin(30, 64).Append(MakeFrame(rng));
+   renderer.Render(10);
+   Check("a frame too tall is drawn in full",
+         renderer.GetLastOutput().substr(0, 7) == "\x1b[H\x1b[2J");
+
+   return 0;
+}
+// ----------------------------------------------------------------------------
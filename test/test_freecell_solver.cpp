@@ -0,0 +1,373 @@
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <iostream>
+#include <random>
+#include <sstream>
+
+// Regular File includes.
+// The shared pass or fail line for each check.
+#include "Check.h"
+// This is the header file for the "FreecellSolver" class.
+#include "../header/FreecellSolver.hpp"
+// ----------------------------------------------------------------------------
+
+using namespace Solitaire;
+
+// ----------------------------------------------------------------------------
+// Type Declarations block.
+// ----------------------------------------------------------------------------
+
+/// @brief Freecell with the checked moves the test needs made public.
+class CheckedFreecell: public Freecell
+{
+   public:
+      using Freecell::MoveBoardToBoard;
+      using Freecell::MoveBoardToStack;
+      using Freecell::MoveBoardToFree;
+      using Freecell::MoveFreeToBoard;
+      using Freecell::MoveFreeToStack;
+      using Freecell::MoveStackToBoard;
+      using Freecell::MoveStackToFree;
+};
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Deal a freecell position from a seed the same way the game does.
+/// @param seed The seed for the shuffle.
+/// @return The position.
+FreecellPosition DealPosition(const uint64_t seed)
+{
+   std::mt19937_64 rng(seed);
+   StandardDeck<PackedStandardPlayingCard> deck;
+   deck.RandomizeDeck(rng);
+
+   std::vector<Pile<PackedStandardPlayingCard>> board(8);
+   for (size_t i = 0; i < 52; i++)
+   {
+      board[i % 8].push_back(deck.DrawOne());
+   }
+
+   FreecellPosition out;
+   out.Load(board,
+            Pile<PackedStandardPlayingCard>(),
+            std::vector<Pile<PackedStandardPlayingCard>>());
+   return out;
+}
+
+/// @brief Make a move through the same checks a player's move goes
+///        through.
+/// @param game The game.
+/// @param move The move.
+/// @return True if the game took the move. False otherwise.
+bool PlayChecked(CheckedFreecell& game, const Move& move)
+{
+   size_t made = game.GetHistory().size();
+   size_t from = move.from_index + 1;
+   size_t to = move.to_index + 1;
+   Suit from_suit = static_cast<Suit>(move.from_index);
+   Suit to_suit = static_cast<Suit>(move.to_index);
+   if (move.from == MovePlace::column && move.to == MovePlace::column)
+   {
+      game.MoveBoardToBoard(from, to, move.amount);
+   }
+   else if (move.from == MovePlace::column &&
+            move.to == MovePlace::foundation)
+   {
+      game.MoveBoardToStack(from, to_suit, false);
+   }
+   else if (move.from == MovePlace::column)
+   {
+      game.MoveBoardToFree(from);
+   }
+   else if (move.from == MovePlace::cell && move.to == MovePlace::column)
+   {
+      game.MoveFreeToBoard(to, from);
+   }
+   else if (move.from == MovePlace::cell)
+   {
+      game.MoveFreeToStack(to_suit, from, false);
+   }
+   else if (move.to == MovePlace::column)
+   {
+      game.MoveStackToBoard(to, from_suit);
+   }
+   else
+   {
+      game.MoveStackToFree(from_suit);
+   }
+   return game.GetHistory().size() == made + 1;
+}
+
+/// @brief Count every move a position calls legal by trying them all.
+/// @param position The position.
+/// @return The amount of legal moves.
+size_t CountLegal(const FreecellPosition& position)
+{
+   const MovePlace places[3] = {MovePlace::column, MovePlace::cell,
+                                MovePlace::foundation};
+   size_t count = 0;
+   for (const MovePlace from : places)
+   {
+      for (const MovePlace to : places)
+      {
+         for (uint8_t i = 0; i < 8; i++)
+         {
+            for (uint8_t j = 0; j < 8; j++)
+            {
+               for (uint8_t amount = 1; amount <= 13; amount++)
+               {
+                  // Cells are packed, so a card always goes to cell 0.
+                  if (to == MovePlace::cell && j > 0)
+                  {
+                     continue;
+                  }
+                  count += position.IsLegal({from, i, to, j, amount});
+               }
+            }
+         }
+      }
+   }
+   return count;
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief This program is for testing the freecell solver.
+/// @return The basic return for a successfully run program.
+int main()
+{
+   FreecellSolver solver;
+
+   // Solve a batch of deals with one solver and check every solution by
+   // playing it back.
+   size_t solved = 0;
+   size_t verified = 0;
+   size_t unsolvable = 0;
+   for (uint64_t seed = 1; seed <= 20; seed++)
+   {
+      FreecellPosition start = DealPosition(seed);
+      FreecellSolveResult result = solver.Solve(start, 200000);
+      if (result.status == FreecellSolveStatus::solved)
+      {
+         solved++;
+         verified += FreecellSolver::Verify(start, result.moves);
+      }
+      else if (result.status == FreecellSolveStatus::unsolvable)
+      {
+         unsolvable++;
+      }
+   }
+   std::cout << "Solved " << solved << " of 20 deals.\n";
+   Check("most deals are solved", solved >= 15);
+   Check("every solution plays back to a win", verified == solved);
+   Check("no random deal is called unsolvable", unsolvable == 0);
+
+   // Numbered deals match the old Microsoft ones. Deal 1 starts with
+   // JD 2D 9H JC 5D 7H 7C 5H.
+   Freecell game;
+   game.DealByNumber(1);
+   const int ranks[8] = {11, 2, 9, 11, 5, 7, 7, 5};
+   const std::string suits[8] = {"diamond", "diamond", "heart", "club",
+                                 "diamond", "heart", "club", "heart"};
+   bool dealt = true;
+   for (size_t i = 0; i < 8; i++)
+   {
+      dealt = dealt && game.GetBoard()[i][0].GetRank() == ranks[i] &&
+              game.GetBoard()[i][0].GetSuit() == suits[i];
+   }
+   Check("deal 1 is the Microsoft deal 1", dealt);
+
+   // The game and the flat deal give the same position, and it solves.
+   uint8_t order[52];
+   MicrosoftDeals::Deal(1, order);
+   FreecellPosition from_game;
+   from_game.Load(game.GetBoard(), game.GetFree(), game.GetStacks());
+   FreecellPosition from_order;
+   from_order.LoadDeal(order);
+   Check("the game and the flat deal match",
+         from_game.Canonical() == from_order.Canonical());
+   FreecellSolveResult deal_one = solver.Solve(game);
+   Check("deal 1 is solved",
+         deal_one.status == FreecellSolveStatus::solved &&
+         FreecellSolver::Verify(from_order, deal_one.moves));
+
+   // Apply and undo should always give back the same position.
+   FreecellPosition start = DealPosition(7);
+   FreecellPosition moved = start;
+   Move to_cell = {MovePlace::column, 3, MovePlace::cell, 0, 1};
+   Check("column to cell is legal", moved.IsLegal(to_cell));
+   moved.Apply(to_cell);
+   Check("the card is in the cell",
+         moved.cell_count == 1 && moved.cells[0] == start.Top(3));
+   moved.Undo(to_cell);
+   bool same = moved.cell_count == 0;
+   for (size_t i = 0; i < 8; i++)
+   {
+      same = same && moved.lengths[i] == start.lengths[i] &&
+             moved.Top(i) == start.Top(i);
+   }
+   Check("undo gives back the same position", same);
+
+   // Swapping columns or cells is the same position.
+   FreecellPosition swapped = start;
+   swapped.Apply(to_cell);
+   swapped.Apply({MovePlace::column, 5, MovePlace::cell, 0, 1});
+   FreecellPosition other = swapped;
+   std::swap(other.cells[0], other.cells[1]);
+   for (size_t i = 0; i < FreecellPosition::column_capacity; i++)
+   {
+      std::swap(other.columns[0][i], other.columns[6][i]);
+   }
+   std::swap(other.lengths[0], other.lengths[6]);
+   Check("swapped columns and cells give the same key",
+         swapped.Canonical() == other.Canonical() &&
+         swapped.Canonical().Hash() == other.Canonical().Hash());
+   Check("a different position gives a different key",
+         !(swapped.Canonical() == start.Canonical()));
+
+   // The game's own apply and undo agree with the position's, and undoing
+   // every move gives back the deal.
+   std::mt19937_64 rng(11);
+   Freecell played;
+   played.DealByNumber(3);
+   FreecellPosition mirror;
+   mirror.Load(played.GetBoard(), played.GetFree(), played.GetStacks());
+   const FreecellKey dealt_key = mirror.Canonical();
+   std::vector<Move> made;
+   Move legal[max_legal_moves];
+   bool agree = true;
+   for (size_t i = 0; i < 200; i++)
+   {
+      size_t count = GenerateLegalMoves(played, legal);
+      if (count == 0)
+      {
+         break;
+      }
+      Move move = legal[rng() % count];
+      played.ApplyMove(move);
+      mirror.Apply(move);
+      made.push_back(move);
+      FreecellPosition loaded;
+      loaded.Load(played.GetBoard(), played.GetFree(), played.GetStacks());
+      agree = agree && loaded.Canonical() == mirror.Canonical();
+   }
+   Check("the game and the position make the same moves", agree);
+   for (size_t i = made.size(); i > 0; i--)
+   {
+      played.UndoMove(made[i - 1]);
+   }
+   FreecellPosition undone;
+   undone.Load(played.GetBoard(), played.GetFree(), played.GetStacks());
+   Check("undoing every game move gives back the deal",
+         undone.Canonical() == dealt_key);
+
+   // Every move written is one the game takes through its own checks, and
+   // nothing the position calls legal is left out. Moves to the foundations
+   // are made more often so cards come back off them too.
+   std::istringstream no_input;
+   std::streambuf* input = std::cin.rdbuf(no_input.rdbuf());
+   CheckedFreecell checked;
+   checked.DealByNumber(5);
+   bool accepted = true;
+   bool complete = true;
+   size_t back_off = 0;
+   for (size_t i = 0; i < 300; i++)
+   {
+      FreecellPosition position;
+      position.Load(checked.GetBoard(), checked.GetFree(),
+                    checked.GetStacks());
+      size_t count = GenerateLegalMoves(checked, legal);
+      complete = complete && count == CountLegal(position);
+      size_t pick = count;
+      for (size_t j = 0; j < count; j++)
+      {
+         CheckedFreecell copy = checked;
+         accepted = accepted && PlayChecked(copy, legal[j]);
+         back_off += legal[j].from == MovePlace::foundation;
+         if (legal[j].to == MovePlace::foundation && rng() % 2 == 0)
+         {
+            pick = j;
+         }
+      }
+      if (count == 0)
+      {
+         break;
+      }
+      PlayChecked(checked, legal[pick < count ? pick : rng() % count]);
+   }
+   std::cin.rdbuf(input);
+   Check("the game takes every generated move", accepted);
+   Check("every legal move is generated", complete);
+   Check("cards are offered back off the foundations", back_off > 0);
+
+   // A broken solution should not verify.
+   FreecellSolveResult result = solver.Solve(start);
+   if (result.status == FreecellSolveStatus::solved)
+   {
+      std::vector<Move> broken = result.moves;
+      broken.pop_back();
+      Check("a short solution does not verify",
+            !FreecellSolver::Verify(start, broken));
+   }
+
+   // A position with no moves at all is unsolvable. The kings fill the
+   // cells and every column ends in two black cards so nothing fits
+   // anywhere.
+   FreecellPosition stuck;
+   std::vector<PackedStandardPlayingCard> reds;
+   std::vector<PackedStandardPlayingCard> blacks;
+   std::vector<PackedStandardPlayingCard> tops;
+   for (size_t id = 0; id < 52; id++)
+   {
+      PackedStandardPlayingCard card = PackedStandardPlayingCard::FromId(id);
+      int rank = card.GetRank();
+      if (rank == 13)
+      {
+         stuck.cells[stuck.cell_count++] = card;
+      }
+      else if (card.GetSuitIndex() & 1)
+      {
+         reds.push_back(card);
+      }
+      else if (rank == 12 || rank == 10 || rank == 8 || rank == 6)
+      {
+         tops.push_back(card);
+      }
+      else
+      {
+         blacks.push_back(card);
+      }
+   }
+   for (size_t i = 0; i < 8; i++)
+   {
+      for (size_t j = 0; j < 3; j++)
+      {
+         stuck.columns[i][stuck.lengths[i]++] = reds[i * 3 + j];
+      }
+      for (size_t j = 0; j < 2; j++)
+      {
+         stuck.columns[i][stuck.lengths[i]++] = blacks[i * 2 + j];
+      }
+      stuck.columns[i][stuck.lengths[i]++] = tops[i];
+   }
+   result = solver.Solve(stuck);
+   Check("a position with no moves is unsolvable",
+         result.status == FreecellSolveStatus::unsolvable &&
+         result.nodes == 1);
+
+   // A tiny budget gives up instead of guessing.
+   result = solver.Solve(DealPosition(3), 5);
+   Check("a tiny budget gives up",
+         result.status == FreecellSolveStatus::gave_up);
+
+   return 0;
+}
@@ -0,0 +1,333 @@
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <iostream>
+#include <random>
+#include <sstream>
+
+// Regular File includes.
+// The shared pass or fail line for each check.
+#include "Check.h"
+// This is the header file for the "KlondikeSolver" class.
+#include "../header/KlondikeSolver.hpp"
+// ----------------------------------------------------------------------------
+
+using namespace Solitaire;
+
+// ----------------------------------------------------------------------------
+// Type Declarations block.
+// ----------------------------------------------------------------------------
+
+/// @brief Klondike with the checked moves the test needs made public.
+class CheckedKlondike: public Klondike
+{
+   public:
+      using Klondike::MoveBoardToBoard;
+      using Klondike::MoveFreeToBoard;
+      using Klondike::MoveFreeToStack;
+      using Klondike::MoveBoardToStack;
+      using Klondike::MoveStackToBoard;
+      using Klondike::DrawCards;
+};
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Check if two positions hold the same cards in the same places.
+/// @param a The first position.
+/// @param b The second position.
+/// @return True if they match.
+bool Same(const KlondikePosition& a, const KlondikePosition& b)
+{
+   bool same = a.stock_count == b.stock_count &&
+               a.waste_count == b.waste_count;
+   for (size_t i = 0; i < 7 && same; i++)
+   {
+      same = a.lengths[i] == b.lengths[i];
+      for (size_t j = 0; j < a.lengths[i] && same; j++)
+      {
+         same = a.columns[i][j] == b.columns[i][j] &&
+                a.columns[i][j].GetFaceUp() == b.columns[i][j].GetFaceUp();
+      }
+   }
+   for (size_t i = 0; i < a.stock_count && same; i++)
+   {
+      same = a.stock[i] == b.stock[i];
+   }
+   for (size_t i = 0; i < a.waste_count && same; i++)
+   {
+      same = a.waste[i] == b.waste[i];
+   }
+   for (size_t i = 0; i < 4 && same; i++)
+   {
+      same = a.foundations[i] == b.foundations[i];
+   }
+   return same;
+}
+
+/// @brief Make a move through the same checks a player's move goes
+///        through. A draw is only ever one draw.
+/// @param game The game.
+/// @param move The move.
+/// @return True if the game took the move. False otherwise.
+bool PlayChecked(CheckedKlondike& game, const Move& move)
+{
+   size_t made = game.GetHistory().size();
+   if (move.from == MovePlace::stock)
+   {
+      game.DrawCards();
+   }
+   else if (move.from == MovePlace::column && move.to == MovePlace::column)
+   {
+      game.MoveBoardToBoard(move.from_index + 1, move.to_index + 1,
+                            move.amount);
+   }
+   else if (move.from == MovePlace::column)
+   {
+      game.MoveBoardToStack(move.from_index + 1,
+                            static_cast<Suit>(move.to_index), false);
+   }
+   else if (move.from == MovePlace::waste && move.to == MovePlace::column)
+   {
+      game.MoveFreeToBoard(move.to_index + 1);
+   }
+   else if (move.from == MovePlace::waste)
+   {
+      game.MoveFreeToStack(static_cast<Suit>(move.to_index), false);
+   }
+   else
+   {
+      game.MoveStackToBoard(move.to_index + 1,
+                            static_cast<Suit>(move.from_index));
+   }
+   return game.GetHistory().size() == made + 1;
+}
+
+/// @brief Count every move other than a draw that the game takes, by
+///        trying them all.
+/// @param game The game.
+/// @return The amount of moves taken.
+size_t CountAccepted(const CheckedKlondike& game)
+{
+   const auto& board = game.GetBoard();
+   size_t count = 0;
+   auto Try = [&](const Move& move)
+   {
+      CheckedKlondike copy = game;
+      count += PlayChecked(copy, move);
+   };
+   for (uint8_t from = 0; from < 7; from++)
+   {
+      for (uint8_t amount = 1; amount <= board[from].size(); amount++)
+      {
+         for (uint8_t to = 0; to < 7; to++)
+         {
+            if (to != from)
+            {
+               Try({MovePlace::column, from, MovePlace::column, to, amount});
+            }
+         }
+      }
+      for (uint8_t suit = 0; suit < 4 && !board[from].empty(); suit++)
+      {
+         Try({MovePlace::column, from, MovePlace::foundation, suit, 1});
+      }
+   }
+   for (uint8_t to = 0; to < 7 && !game.GetFree().empty(); to++)
+   {
+      Try({MovePlace::waste, 0, MovePlace::column, to, 1});
+   }
+   for (uint8_t suit = 0; suit < 4 && !game.GetFree().empty(); suit++)
+   {
+      Try({MovePlace::waste, 0, MovePlace::foundation, suit, 1});
+   }
+   for (uint8_t suit = 0; suit < 4; suit++)
+   {
+      for (uint8_t to = 0; to < 7; to++)
+      {
+         Try({MovePlace::foundation, suit, MovePlace::column, to, 1});
+      }
+   }
+   return count;
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief This program is for testing the klondike solver.
+/// @return The basic return for a successfully run program.
+int main()
+{
+   KlondikeSolver solver;
+   uint8_t order[52];
+
+   // The game and the flat deal give the same position.
+   Klondike game;
+   game.DealBySeed(5);
+   MicrosoftDeals::Deal(5, order);
+   KlondikePosition from_game;
+   from_game.Load(game);
+   KlondikePosition from_order;
+   from_order.LoadDeal(order, 3);
+   Check("the game and the flat deal match", Same(from_game, from_order));
+   Check("a new deal has 21 cards face down", from_order.FaceDown() == 21);
+
+   // Drawing all the way around the stock and back gives the same
+   // position, and undoing the draws does too.
+   KlondikePosition drawn = from_order;
+   std::vector<Move> draws;
+   for (size_t i = 0; i < 9; i++)
+   {
+      Move draw = {MovePlace::stock, 0, MovePlace::waste, 0, 1};
+      drawn.Apply(draw);
+      draws.push_back(draw);
+   }
+   Check("eight draws of three empty the stock",
+         draws[7].waste_before == 21 && draws[8].waste_before == 24 &&
+         drawn.waste_count == 3 && drawn.stock_count == 21);
+   KlondikePosition around = drawn;
+   Move many = {MovePlace::stock, 0, MovePlace::waste, 0, 8};
+   around.Apply(many);
+   Check("a full turn of the stock comes back around", Same(around, drawn));
+   around.Undo(many);
+   for (size_t i = 9; i > 0; i--)
+   {
+      around.Undo(draws[i - 1]);
+   }
+   Check("undoing the draws gives back the deal", Same(around, from_order));
+
+   // Solve a batch of deals seeing every card and play each solution back.
+   for (uint8_t draw_count : {uint8_t(1), uint8_t(3)})
+   {
+      size_t solved = 0;
+      size_t verified = 0;
+      for (uint32_t deal = 1; deal <= 10; deal++)
+      {
+         MicrosoftDeals::Deal(deal, order);
+         KlondikePosition start;
+         start.LoadDeal(order, draw_count);
+         KlondikeSolveResult result = solver.SolveThoughtful(start, 100000);
+         if (result.status == KlondikeSolveStatus::solved)
+         {
+            solved++;
+            verified += KlondikeSolver::Verify(start, result.moves);
+         }
+      }
+      std::cout << "Draw " << int(draw_count) << ": solved " << solved
+                << " of 10 deals.\n";
+      Check("some deals are solved", solved >= 4);
+      Check("every solution plays back to a win", verified == solved);
+   }
+
+   // The game's own apply and undo agree with the position's, through
+   // flips and turning the stock over, and undoing every move gives back
+   // the deal.
+   std::mt19937_64 moves_rng(11);
+   Move legal[max_legal_moves];
+   std::vector<Move> made;
+   bool agree = true;
+   for (size_t i = 0; i < 300; i++)
+   {
+      size_t count = GenerateLegalMoves(game, legal);
+      if (count == 0)
+      {
+         break;
+      }
+      Move move = legal[moves_rng() % count];
+      Move copy = move;
+      game.ApplyMove(move);
+      from_order.Apply(copy);
+      made.push_back(move);
+      KlondikePosition loaded;
+      loaded.Load(game);
+      agree = agree && Same(loaded, from_order) &&
+              move.flipped == copy.flipped;
+   }
+   Check("the game and the position make the same moves", agree);
+   for (size_t i = made.size(); i > 0; i--)
+   {
+      game.UndoMove(made[i - 1]);
+   }
+   KlondikePosition undone;
+   undone.Load(game);
+   MicrosoftDeals::Deal(5, order);
+   from_order.LoadDeal(order, 3);
+   Check("undoing every game move gives back the deal",
+         Same(undone, from_order));
+
+   // Loading a game forgets what was seen in the last one.
+   KlondikePosition reused = undone;
+   reused.seen = ~uint64_t(0);
+   reused.Load(game);
+   Check("a reused position only sees the new game's cards",
+         reused.seen == undone.seen);
+
+   // Play a winning game and check every position on the way. Every move
+   // written is one the game takes through its own checks, and nothing the
+   // game takes is left out. A won game empties columns, so kings get
+   // offered to more than one empty column.
+   CheckedKlondike checked;
+   KlondikeSolveResult winning;
+   for (uint32_t deal = 1; winning.status != KlondikeSolveStatus::solved;
+        deal++)
+   {
+      checked.DealBySeed(deal);
+      KlondikePosition dealt;
+      dealt.Load(checked);
+      winning = solver.SolveThoughtful(dealt);
+   }
+   std::istringstream no_input;
+   std::ostringstream no_output;
+   std::streambuf* input = std::cin.rdbuf(no_input.rdbuf());
+   std::streambuf* output = std::cout.rdbuf(no_output.rdbuf());
+   bool accepted = true;
+   bool complete = true;
+   size_t spread = 0;
+   for (Move move : winning.moves)
+   {
+      size_t count = GenerateLegalMoves(checked, legal);
+      size_t draws = 0;
+      size_t empties = 0;
+      for (size_t i = 0; i < count; i++)
+      {
+         CheckedKlondike copy = checked;
+         accepted = accepted && PlayChecked(copy, legal[i]);
+         draws += legal[i].from == MovePlace::stock;
+         if (legal[i].to == MovePlace::column &&
+             checked.GetBoard()[legal[i].to_index].empty())
+         {
+            empties |= size_t(1) << legal[i].to_index;
+         }
+      }
+      complete = complete && count - draws == CountAccepted(checked);
+      spread += empties != 0 && (empties & (empties - 1)) != 0;
+      checked.ApplyMove(move);
+   }
+   std::cin.rdbuf(input);
+   std::cout.rdbuf(output);
+   Check("the game takes every generated move", accepted);
+   Check("every move the game takes is generated", complete);
+   Check("kings are offered to every empty column", spread > 0);
+
+   // Playing without seeing the face down cards.
+   MicrosoftDeals::Deal(1, order);
+   KlondikePosition start;
+   start.LoadDeal(order, 1);
+   double rate = KlondikeSolver::EstimateWinRate(start, 10, 1);
+   Check("the win rate is a fraction", rate >= 0 && rate <= 1);
+   Check("the same seed gives the same win rate",
+         rate == KlondikeSolver::EstimateWinRate(start, 10, 1));
+   std::mt19937_64 rng(3);
+   KlondikePlayResult played = KlondikeSolver::PlayRealistic(start, rng);
+   Check("a played game ends", played.moves > 0 && played.home <= 52 &&
+                               played.won == (played.home == 52));
+
+   return 0;
+}
+// ----------------------------------------------------------------------------
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <iostream>
+#include <type_traits>
+
+// Regular File includes.
+// The shared pass or fail line for each check.
+#include "Check.h"
+// This is the header file for the "StandardDeck" class which brings in the
+// packed cards.
+#include "../header/StandardDeck.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief This function takes a graphic string and then outputs the 
+///        graphic to the console.
+/// @param graphic The graphic string from a card.
+void OutputCardGraphic(const CardGraphicsAndInfo::CardArt& graphic)
+{
+   for (size_t i = 0; i < graphic.size(); i++)
+   {
+      std::cout << graphic[i] << "\n";
+   }
+   std::cout << "\n";
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief This program is for testing the packed playing card classes.
+/// @return The basic return for a successfully run program.
+int main()
+{
+   // The whole point of these is that they are one byte and can be copied
+   // around like an int.
+   Check("packed card is one byte",
+         sizeof(PackedStandardPlayingCard) == 1);
+   Check("packed polar card is one byte",
+         sizeof(PackedPolarStandardPlayingCard) == 1);
+   Check("packed card is trivially copyable",
+         std::is_trivially_copyable<PackedStandardPlayingCard>::value);
+   Check("packed polar card is trivially copyable",
+         std::is_trivially_copyable<PackedPolarStandardPlayingCard>::value);
+
+   // Constructing a Jack of Spades.
+   PackedStandardPlayingCard card1(11,"spade");
+   std::cout << "Card1: " << card1.GetRank() << " of " 
+             << card1.GetSuit() << "s.\n";
+   OutputCardGraphic(card1.GetGraphic());
+
+   // The graphic should be the same one the heap card finds.
+   StandardPlayingCard heap_card(11,"spade");
+   Check("graphic matches StandardPlayingCard",
+         card1.GetGraphic() == heap_card.GetGraphic());
+
+   // Copy it.
+   PackedStandardPlayingCard card2(card1);
+   Check("cards are equal", card1 == card2);
+   Check("color of a spade", card1.GetColor() == "black");
+   Check("color of a diamond",
+         PackedStandardPlayingCard(4,"diamond").GetColor() == "red");
+   // The graphics are made when compiling.
+   constexpr bool ten_of_hearts = 
+      CardGraphicsAndInfo::graphics[1][9][1] == 
+         "|10 \xe2\x99\xa5   \xe2\x99\xa5   |";
+   Check("graphics are made when compiling", ten_of_hearts);
+   Check("suit and color values",
+         card1.GetSuitType() == CardGraphicsAndInfo::Suit::spade &&
+         card1.GetColorType() == CardGraphicsAndInfo::Color::black &&
+         PackedStandardPlayingCard(4,"heart").GetColorType() ==
+            CardGraphicsAndInfo::Color::red);
+
+   // This should fail and be "no card".
+   std::cout << "This should fail and be unknown.\n";
+   PackedStandardPlayingCard card3(1324,"dsaf");
+   Check("invalid card is no card", !card3);
+   OutputCardGraphic(card3.GetGraphic());
+
+   // Every id should go there and back again.
+   bool ids = true;
+   for (size_t id = 0; id < 52; id++)
+   {
+      ids = ids && PackedStandardPlayingCard::FromId(id).GetId() == id;
+   }
+   Check("ids round trip", ids);
+
+   // This will test the flipping mechanic.
+   PackedPolarStandardPlayingCard card4(1,"heart");
+   std::cout << "Flipped? " << card4.GetFaceUp() << "\n";
+   card4.FlipCard();
+   std::cout << "Flipped? " << card4.GetFaceUp() << "\n";
+   Check("flip keeps the rank and suit",
+         card4.GetRank() == 1 && card4.GetSuit() == "heart");
+   card4.FlipCard();
+   std::cout << "Flipped? " << card4.GetFaceUp() << "\n";
+
+   // A packed deck should have all 52 cards in the same order as a heap one.
+   StandardDeck<PackedStandardPlayingCard> deck1;
+   StandardDeck<StandardPlayingCard>       deck2;
+   bool same = deck1.GetDeck().size() == 52;
+   for (size_t i = 0; i < deck1.GetDeck().size() && same; i++)
+   {
+      same = deck1.GetDeck()[i]->GetRank() == deck2.GetDeck()[i]->GetRank() &&
+             deck1.GetDeck()[i]->GetSuit() == deck2.GetDeck()[i]->GetSuit();
+   }
+   Check("packed deck matches heap deck", same);
+
+   // Drawing from an empty deck should give "no card".
+   while (deck1.DrawOne()) {}
+   Check("empty deck draws no card", !deck1.DrawOne());
+
+   return 0;
+}
+// ----------------------------------------------------------------------------
@@ -3,11 +3,19 @@
 // ----------------------------------------------------------------------------
 
 // Standard Library includes.
+#include <algorithm>
+#include <array>
 #include <iostream>
+#include <string>
+#include <type_traits>
 
 // Regular File includes.
+// The shared pass or fail line for each check.
+#include "Check.h"
 // This is the header file for the "StandardDeck" class.
 #include "../header/StandardDeck.hpp"
+// This is the header file for the "DealBatch" class.
+#include "../header/DealBatch.hpp"
 // ----------------------------------------------------------------------------
 
 // ----------------------------------------------------------------------------
@@ -55,7 +63,7 @@ int main()
 
    // Now do a riffle shuffle. Split the deck by 34 cards let the top fall
    // first, and let a random amount fall each time.
-   deck1.Riffle(34,"top","random");
+   deck1.Riffle(34, RiffleDownFirst::top, RiffleType::random);
    // Output the deck to console to check it.
    OutputStandardDeck(deck1);
 
@@ -78,6 +86,178 @@ int main()
    // Output the deck to console to check it.
    OutputStandardDeck(deck2);
 
+   // Two decks with the same seed shuffle the same way.
+   StandardDeck<PackedStandardPlayingCard> seeded1;
+   StandardDeck<PackedStandardPlayingCard> seeded2;
+   seeded1.SetSeed(42);
+   seeded2.SetSeed(42);
+   seeded1.RandomizeDeck();
+   seeded2.RandomizeDeck();
+   bool same = true;
+   for (size_t i = 0; i < 52; i++)
+   {
+      same = same && seeded1.GetDeck()[i].GetRank() ==
+                     seeded2.GetDeck()[i].GetRank() &&
+                     seeded1.GetDeck()[i].GetSuitType() ==
+                     seeded2.GetDeck()[i].GetSuitType();
+   }
+   Check("the same seed gives the same shuffle", same);
+
+   // A copy gets its own seed, so it doesn't repeat the original's shuffle.
+   StandardDeck<PackedStandardPlayingCard> source;
+   source.SetSeed(42);
+   StandardDeck<PackedStandardPlayingCard> copied(source);
+   source.RandomizeDeck();
+   copied.RandomizeDeck();
+   bool repeated = true;
+   for (size_t i = 0; i < 52; i++)
+   {
+      repeated = repeated && source.GetDeck()[i].GetId() ==
+                             copied.GetDeck()[i].GetId();
+   }
+   Check("a copied deck shuffles on its own", !repeated);
+
+   // Every card should end up on top about as often as any other. With
+   // 52000 shuffles each card is expected 1000 times and is very unlikely
+   // to be off by more than 200.
+   std::array<size_t, 52> on_top{};
+   for (size_t i = 0; i < 52000; i++)
+   {
+      seeded1.RandomizeDeck();
+      const PackedStandardPlayingCard& top = seeded1.GetDeck().back();
+      on_top[static_cast<size_t>(top.GetSuitType()) * 13 +
+             top.GetRank() - 1]++;
+   }
+   bool even = true;
+   for (const size_t count : on_top)
+   {
+      even = even && count > 800 && count < 1200;
+   }
+   Check("every card is as likely to end up on top", even);
+
+   // Eight perfect riffles where the bottom card falls first put a deck of
+   // 52 back in order.
+   StandardDeck<PackedStandardPlayingCard> riffled;
+   for (size_t i = 0; i < 8; i++)
+   {
+      riffled.Riffle(26, RiffleDownFirst::bottom, RiffleType::perfect);
+   }
+   bool in_order = true;
+   for (size_t i = 0; i < 52; i++)
+   {
+      const PackedStandardPlayingCard& card = riffled.GetDeck()[i];
+      in_order = in_order &&
+                 static_cast<size_t>(card.GetSuitType()) * 13 +
+                 card.GetRank() - 1 == i;
+   }
+   Check("eight perfect riffles put the deck back in order", in_order);
+
+   // One Gilbert-Shannon-Reeds riffle of a fresh deck leaves at most two
+   // runs of cards in their first order.
+   StandardDeck<PackedStandardPlayingCard> modelled;
+   modelled.SetSeed(7);
+   modelled.RiffleGilbertShannonReeds();
+   std::array<size_t, 52> where{};
+   for (size_t i = 0; i < modelled.GetDeck().size(); i++)
+   {
+      const PackedStandardPlayingCard& card = modelled.GetDeck()[i];
+      where[static_cast<size_t>(card.GetSuitType()) * 13 +
+            card.GetRank() - 1] = i;
+   }
+   size_t runs = 1;
+   for (size_t i = 1; i < 52; i++)
+   {
+      runs += where[i] < where[i - 1];
+   }
+   Check("a Gilbert-Shannon-Reeds riffle makes at most two runs",
+         modelled.GetDeck().size() == 52 && runs <= 2);
+
+   // A batch row is the deck a fresh deck with the row's seed shuffles to,
+   // no matter how many threads filled the batch.
+   DealBatch batch(10000);
+   DealBatch one_thread(10000);
+   batch.Fill(99, 4);
+   one_thread.Fill(99, 1);
+   StandardDeck<StandardPlayingCard> row_deck;
+   row_deck.SetSeed(Random::StreamSeed(99, 1234));
+   row_deck.RandomizeDeck();
+   StandardDeck<StandardPlayingCard> from_row =
+      batch.MakeDeck<StandardPlayingCard>(1234);
+   bool row_same = true;
+   for (size_t i = 0; i < 52; i++)
+   {
+      row_same = row_same &&
+                 *row_deck.GetDeck()[i] == *from_row.GetDeck()[i];
+   }
+   Check("a batch row matches a deck with the same seed", row_same);
+   Check("a batch is the same for any amount of threads",
+         std::equal(batch.GetData(), batch.GetData() + 10000 * 52,
+                    one_thread.GetData()));
+
+   // A fresh deck is rank 0, a deck in reverse is the last rank and any
+   // deck comes back from its rank.
+   StandardDeck<PackedStandardPlayingCard> fresh;
+   DealRank::Rank fresh_rank{};
+   fresh_rank.fill(0xff);
+   fresh.GetDealRank(fresh_rank);
+   uint8_t reverse_ids[52];
+   for (size_t i = 0; i < 52; i++)
+   {
+      reverse_ids[i] = static_cast<uint8_t>(51 - i);
+   }
+   DealRank::Rank last_rank{};
+   DealRank::Encode(reverse_ids, last_rank);
+   // 52! - 1 and 52! written out in hexadecimal.
+   const DealRank::Rank expected_last = {
+      0x02, 0xfd, 0xe5, 0x29, 0xa3, 0x27, 0x4c, 0x64, 0x9c, 0xfe,
+      0xb4, 0xb1, 0x80, 0xad, 0xb5, 0xcb, 0x96, 0x02, 0xa9, 0xe0,
+      0x63, 0x8a, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+   const DealRank::Rank too_big = {
+      0x02, 0xfd, 0xe5, 0x29, 0xa3, 0x27, 0x4c, 0x64, 0x9c, 0xfe,
+      0xb4, 0xb1, 0x80, 0xad, 0xb5, 0xcb, 0x96, 0x02, 0xa9, 0xe0,
+      0x63, 0x8a, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+   uint8_t unused[52];
+   Check("deal ranks run from 0 to 52! - 1",
+         fresh_rank == DealRank::Rank{} && last_rank == expected_last &&
+         !DealRank::Decode(too_big, unused));
+
+   bool round_trip = true;
+   for (size_t i = 0; i < 1000; i++)
+   {
+      DealRank::Rank rank{};
+      StandardDeck<StandardPlayingCard> original =
+         batch.MakeDeck<StandardPlayingCard>(i);
+      original.GetDealRank(rank);
+      StandardDeck<StandardPlayingCard> decoded =
+         StandardDeck<StandardPlayingCard>::FromDealRank(rank);
+      for (size_t j = 0; j < 52; j++)
+      {
+         round_trip = round_trip && decoded.GetDeck().size() == 52 &&
+                      *decoded.GetDeck()[j] == *original.GetDeck()[j];
+      }
+   }
+   Check("a deck comes back the same from its rank", round_trip);
+
+   // Piles keep their cards inside themselves.
+   StandardDeck<PackedStandardPlayingCard> packed;
+   Pile<PackedStandardPlayingCard> packed_copy = packed.GetDeck();
+   packed_copy.erase(packed_copy.begin(), packed_copy.begin() + 13);
+   packed_copy.insert(packed_copy.end(), packed.GetDeck().begin(),
+                      packed.GetDeck().begin() + 13);
+   Check("a pile of packed cards is one small block",
+         sizeof(Pile<PackedStandardPlayingCard>) == 53 &&
+         std::is_trivially_copyable<Pile<PackedStandardPlayingCard>>::value &&
+         packed_copy.size() == 52 &&
+         packed_copy[0].GetId() == 13 && packed_copy[51].GetId() == 12);
+
+   StandardDeck<StandardPlayingCard> heap;
+   Pile<StandardPlayingCard> taken = heap.Split(52).first;
+   Pile<StandardPlayingCard> moved = std::move(taken);
+   moved.pop_back();
+   Check("moving a pile of heap cards leaves it empty",
+         taken.empty() && moved.size() == 51 && moved.back() != nullptr &&
+         heap.GetDeck().empty());
+
    return 0;
 }
 // ----------------------------------------------------------------------------
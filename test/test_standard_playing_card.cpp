@@ -17,7 +17,7 @@
 /// @brief This function takes a graphic string and then outputs the 
 ///        graphic to the console.
 /// @param graphic The graphic string from a card.
-void OutputCardGraphic(std::vector<std::string> graphic)
+void OutputCardGraphic(const CardGraphicsAndInfo::CardArt& graphic)
 {
    for (size_t i = 0; i < graphic.size(); i++)
    {
@@ -0,0 +1,111 @@
+// Record the traces so there is something to check.
+#define TRACING
+
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+// Regular File includes.
+// The shared pass or fail line for each check.
+#include "Check.h"
+// The tracing itself.
+#include "../header/Trace.h"
+// The game whose hot parts are traced.
+#include "../header/Freecell.hpp"
+// ----------------------------------------------------------------------------
+
+using namespace Solitaire;
+
+// ----------------------------------------------------------------------------
+// Type Declarations block.
+// ----------------------------------------------------------------------------
+
+/// @brief Freecell with the auto-move the test needs made public.
+class TraceFreecell: public Freecell
+{
+   public:
+      using Freecell::AutoMove;
+};
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Count how many times some text is in a string.
+/// @param text The string.
+/// @param part The text to look for.
+/// @return The amount of times.
+size_t CountOf(const std::string& text, const std::string& part)
+{
+   size_t count = 0;
+   for (size_t at = text.find(part); at != std::string::npos;
+        at = text.find(part, at + 1))
+   {
+      count++;
+   }
+   return count;
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief This program is for testing the tracing.
+/// @return The basic return for a successfully run program.
+int main()
+{
+   // A timer inside another ends first and takes no longer.
+   {
+      TRACE_SCOPE("outer");
+      {
+         TRACE_SCOPE("inner");
+         TRACE_COUNTER("cards", 52);
+      }
+   }
+   const Trace::ThreadBuffer& buffer = Trace::GetThreadBuffer();
+   Check("Events are recorded as they end", buffer.events.size() == 3 &&
+         std::string(buffer.events[0].name) == "cards" &&
+         std::string(buffer.events[1].name) == "inner" &&
+         std::string(buffer.events[2].name) == "outer");
+   Check("An inner timer is inside the outer one",
+         buffer.events[2].start <= buffer.events[1].start &&
+         buffer.events[1].value <= buffer.events[2].value);
+
+   // Another thread records into its own buffer.
+   std::thread other([]() { TRACE_SCOPE("other thread"); });
+   other.join();
+
+   // Auto-moving in Freecell is traced.
+   TraceFreecell freecell;
+   freecell.DealByNumber(1);
+   freecell.AutoMove();
+
+   std::ostringstream out;
+   Trace::WriteChromeJson(out);
+   const std::string json = out.str();
+   Check("The trace is a Chrome trace",
+         json.rfind("{\"traceEvents\":[", 0) == 0 &&
+         CountOf(json, "\"ph\":\"X\"") == 4 &&
+         CountOf(json, "\"ph\":\"C\"") == 1);
+   Check("Each thread has its own id",
+         CountOf(json, "\"tid\":1,") == 4 && CountOf(json, "\"tid\":2,") == 1);
+   Check("Game functions are traced",
+         CountOf(json, "Solitaire::AutoMove") == 1);
+
+   Trace::Clear();
+   std::ostringstream empty;
+   Trace::WriteChromeJson(empty);
+   Check("Clear throws away every event",
+         CountOf(empty.str(), "\"name\"") == 0);
+
+   return 0;
+}
+// ----------------------------------------------------------------------------
@@ -0,0 +1,129 @@
+// ----------------------------------------------------------------------------
+// Includes block.
+// ----------------------------------------------------------------------------
+
+// Standard Library includes.
+#include <initializer_list>
+#include <iostream>
+
+// Regular File includes.
+// The shared pass or fail line for each check.
+#include "Check.h"
+// This is the header file for the headless war rules.
+#include "../header/WarEngine.hpp"
+// This is the header file for playing batches of games on many threads.
+#include "../header/WarMonteCarlo.hpp"
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Functions block.
+// ----------------------------------------------------------------------------
+
+/// @brief Make a hand from ranks, bottom first. The suit does not matter to
+///        war so each hand gets its own.
+/// @param ranks The ranks.
+/// @param suit_index The suit for every card.
+/// @return The hand.
+WarHand MakeHand(std::initializer_list<int> ranks, const size_t suit_index)
+{
+   WarHand hand;
+   for (const int rank : ranks)
+   {
+      hand.PushTop(PackedStandardPlayingCard(rank, suit_index));
+   }
+   return hand;
+}
+// ----------------------------------------------------------------------------
+
+// ----------------------------------------------------------------------------
+// Main block.
+// ----------------------------------------------------------------------------
+
+/// @brief This program is for testing the "WarEngine" class.
+/// @return The basic return for a successfully run program.
+int main()
+{
+   // Cards put on the bottom come off the top in the same order, even once
+   // the ring has wrapped around many times.
+   WarHand ring;
+   bool fifo = ring.Empty();
+   for (size_t id = 0; id < 52; id++)
+   {
+      ring.PushBottom(PackedStandardPlayingCard::FromId(id));
+   }
+   fifo = fifo && ring.Size() == 52;
+   for (size_t i = 0; i < 52 * 3 + 7; i++)
+   {
+      const PackedStandardPlayingCard card = ring.PopTop();
+      fifo = fifo && card.GetId() == i % 52;
+      ring.PushBottom(card);
+   }
+   fifo = fifo && ring.Size() == 52;
+   for (size_t i = 0; i < 52; i++)
+   {
+      fifo = fifo && ring.PopTop().GetId() == (i + 7) % 52;
+   }
+   fifo = fifo && ring.Empty();
+   ring.PushBottom(PackedStandardPlayingCard::FromId(9));
+   fifo = fifo && ring.Size() == 1 && ring.PopTop().GetId() == 9 &&
+          ring.Empty();
+   Check("a hand keeps its order across the wrap and when empty or full",
+         fifo);
+
+   WarRules played_rules;
+   played_rules.return_order  = WarReturnOrder::played;
+   played_rules.detect_cycles = true;
+   WarEngine engine(0, played_rules);
+
+   // The opponent has a 4 on a 2 and the player a 3 on a 5. With won cards
+   // going back in the order they were played this comes back around every
+   // four rounds forever.
+   const WarHands looping(MakeHand({2, 4}, 0), MakeHand({5, 3}, 1));
+   WarResult result = engine.PlayHands(looping, 1000);
+   Check("a hand known to loop is found cycling well before the cap",
+         result.outcome == WarOutcome::cycling && result.rounds < 20 &&
+         result.cycle_length == 4);
+
+   // The opponent's 4 beats the 3. The 4 was played first so it goes on the
+   // very bottom with the 3 on it.
+   result = engine.PlayHands(looping, 1);
+   const WarHand& winner = engine.GetHands().first;
+   Check("won cards go back in the order they were played",
+         winner.Size() == 3 && winner.At(0).GetRank() == 4 &&
+         winner.At(1).GetRank() == 3 && winner.At(2).GetRank() == 2 &&
+         engine.GetHands().second.Size() == 1);
+   Check("a tiny round limit gives capped",
+         result.outcome == WarOutcome::capped && result.rounds == 1);
+
+   WarEngine shuffled;
+   result = shuffled.PlayAGame(1, 100000);
+   Check("a normal seed finishes",
+         (result.outcome == WarOutcome::player_won ||
+          result.outcome == WarOutcome::opponent_won) &&
+         result.rounds < 100000 &&
+         shuffled.GetHands().first.Size() +
+            shuffled.GetHands().second.Size() == 52);
+   Check("the same seed plays the same game",
+         shuffled.PlayAGame(1, 100000).rounds == result.rounds);
+
+   result = shuffled.PlayAGame(1, 3);
+   Check("a seeded game stopped early is capped",
+         result.outcome == WarOutcome::capped && result.rounds == 3);
+
+   // Enough games that every thread takes several chunks.
+   const WarStatistics one  = WarMonteCarlo(7, 2000, 1).Run(20000);
+   const WarStatistics many = WarMonteCarlo(7, 2000, 4).Run(20000);
+   bool same_outcomes = true;
+   for (size_t i = 0; i < war_outcome_count; i++)
+   {
+      same_outcomes = same_outcomes && one.outcomes[i] == many.outcomes[i];
+   }
+   Check("a batch does not depend on the amount of threads",
+         one.games == 20000 && many.games == 20000 && same_outcomes &&
+         one.total_rounds == many.total_rounds &&
+         one.total_wars == many.total_wars &&
+         one.length_histogram == many.length_histogram);
+
+   return 0;
+}
+// ----------------------------------------------------------------------------